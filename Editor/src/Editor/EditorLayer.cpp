@@ -1,6 +1,7 @@
 #include "Editor/EditorLayer.hpp"
 
 #include <Vanta/Project/Project.hpp>
+#include <Vanta/Scene/BinarySerializer.hpp>
 #include <Vanta/Scene/Serializer.hpp>
 #include <Vanta/Scripts/ScriptManager.hpp>
 
@@ -97,11 +98,19 @@ namespace Vanta {
             int mouseX = (int)mx;
             int mouseY = (int)my;
 
-            if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)viewportSize.x && mouseY < (int)viewportSize.y) {
-                int pixelData = m_Framebuffer->ReadPixel(1, mouseX, mouseY);
+            // The entity under the mouse arrives a frame or two late, so reading it back doesn't stall on the GPU
+            if (mouseX >= 0 && mouseY >= 0 && mouseX < (int)viewportSize.x && mouseY < (int)viewportSize.y)
+                m_Framebuffer->RequestPixels(1, mouseX, mouseY, 1, 1);
+
+            if (m_Framebuffer->PollPixels(m_HoveredReadback)) {
+                int pixelData = m_HoveredReadback.Get(0, 0);
                 m_HoveredEntity = pixelData != -1 ? Entity((entt::entity)pixelData, m_ActiveScene.get()) : Entity();
             }
 
+            // The entity may have been destroyed since it was drawn
+            if (!m_HoveredEntity)
+                m_HoveredEntity = Entity();
+
             RenderOverlay();
 
             m_Framebuffer->Unbind();
@@ -233,6 +242,9 @@ namespace Vanta {
                     if (ImGui::MenuItem("New Scene"))
                         NewScene();
 
+                    if (ImGui::MenuItem("Export Binary Scene", nullptr, false, !m_SceneFilepath.empty()))
+                        ExportBinaryScene();
+
                     ImGui::Separator();
 
                     if (ImGui::MenuItem("Exit"))
@@ -277,7 +289,11 @@ namespace Vanta {
                 ImGui::Text("Renderer2D Stats:");
                 ImGui::Text(FMT("FPS: {}", Engine::Get().GetFPS()).c_str());
                 ImGui::Text(FMT("Draw Calls: {}", stats.DrawCalls).c_str());
+                ImGui::Text(FMT("Batches: {}", stats.BatchCount).c_str());
                 ImGui::Text(FMT("Quads: {}", stats.QuadCount).c_str());
+                ImGui::Text(FMT("Instances: {}", stats.InstanceCount).c_str());
+                ImGui::Text(FMT("Visible: {}", stats.VisibleCount).c_str());
+                ImGui::Text(FMT("Culled: {}", stats.CulledCount).c_str());
                 ImGui::Text(FMT("Vertices: {}", stats.GetVertexCount()).c_str());
                 ImGui::Text(FMT("Indices: {}", stats.GetIndexCount()).c_str());
 
@@ -748,7 +764,8 @@ namespace Vanta {
             if (m_State != State::Edit)
                 OnStop();
 
-            if (fixedFilepath.extension().string() != ".vnta") {
+            const bool binary = BinarySceneSerializer::IsBinary(fixedFilepath);
+            if (fixedFilepath.extension().string() != ".vnta" && !binary) {
                 VANTA_ERROR("Could not load {}; incorrect file type", filepath.filename());
                 return;
             }
@@ -758,20 +775,32 @@ namespace Vanta {
 
             // Deserialize scene
             Ref<Scene> newScene = NewRef<Scene>();
-            SceneSerializer serializer(fixedFilepath);
-            if (!serializer.Deserialize(newScene)) {
-                VANTA_ERROR("Failed to parse scene file: {}", fixedFilepath.filename());
-                return;
-            }
+            if (binary) {
+                BinarySceneSerializer serializer(fixedFilepath);
+                if (!serializer.Deserialize(newScene)) {
+                    VANTA_ERROR("Failed to read binary scene file: {}", fixedFilepath.filename());
+                    return;
+                }
 
-            auto viewportCameraPos = serializer.Get<glm::vec3>("ViewportCameraPosition");
-            if (viewportCameraPos) {
-                m_EditorCamera.SetPosition(viewportCameraPos.value());
+                // Binary scenes aren't edited directly; saving converts them back to text
+                fixedFilepath.replace_extension(".vnta");
             }
+            else {
+                SceneSerializer serializer(fixedFilepath);
+                if (!serializer.Deserialize(newScene)) {
+                    VANTA_ERROR("Failed to parse scene file: {}", fixedFilepath.filename());
+                    return;
+                }
 
-            auto viewportCameraRot = serializer.Get<glm::vec3>("ViewportCameraRotation");
-            if (viewportCameraRot) {
-                m_EditorCamera.SetRotationDeg(viewportCameraRot.value());
+                auto viewportCameraPos = serializer.Get<glm::vec3>("ViewportCameraPosition");
+                if (viewportCameraPos) {
+                    m_EditorCamera.SetPosition(viewportCameraPos.value());
+                }
+
+                auto viewportCameraRot = serializer.Get<glm::vec3>("ViewportCameraRotation");
+                if (viewportCameraRot) {
+                    m_EditorCamera.SetRotationDeg(viewportCameraRot.value());
+                }
             }
 
             // Setup scene data
@@ -791,6 +820,10 @@ namespace Vanta {
                 serializer.Serialize(m_EditorScene);
                 serializer.Append("ViewportCameraPosition", m_EditorCamera.GetPosition());
                 serializer.Append("ViewportCameraRotation", m_EditorCamera.GetRotationDeg());
+
+                // Keep an exported binary scene in step with its text
+                if (IO::File(BinarySceneSerializer::GetBinaryPath(m_SceneFilepath)).Exists())
+                    ExportBinaryScene();
             }
             else {
                 SaveSceneAs();
@@ -809,5 +842,19 @@ namespace Vanta {
                 m_SceneFilepath = file->Filepath;
             }
         }
+
+        void EditorLayer::ExportBinaryScene() {
+            VANTA_PROFILE_FUNCTION();
+
+            if (m_SceneFilepath.empty()) {
+                VANTA_WARN("Save the scene before exporting it");
+                return;
+            }
+
+            Path binaryPath = BinarySceneSerializer::GetBinaryPath(m_SceneFilepath);
+            BinarySceneSerializer serializer(binaryPath);
+            if (!serializer.Serialize(m_EditorScene))
+                VANTA_ERROR("Failed to export binary scene: {}", binaryPath.filename());
+        }
     }
 }
@@ -54,6 +54,7 @@ namespace Vanta {
             bool m_ShowPhysicsColliders = false;
 
             Entity m_HoveredEntity;
+            FramebufferReadback m_HoveredReadback;
             int m_GizmoType = -1;
 
             Ref<Texture2D> m_IconPlay;
@@ -87,6 +88,7 @@ namespace Vanta {
             void OpenScene(const Path& path);
             void SaveScene();
             void SaveSceneAs();
+            void ExportBinaryScene();
         };
     }
 }
@@ -224,7 +224,7 @@ namespace Vanta {
                     if (ImGui::BeginDragDropTarget()) {
                         if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_BROWSER_ITEM")) {
                             const wchar_t* path = (const wchar_t*)payload->Data;
-                            component.Texture = Texture2D::Create(path);
+                            component.Texture = AssetManager::LoadTexture(path);
                         }
                         ImGui::EndDragDropTarget();
                     }
@@ -234,7 +234,7 @@ namespace Vanta {
                     if (ImGui::BeginDragDropTarget()) {
                         if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("CONTENT_BROWSER_ITEM")) {
                             const wchar_t* path = (const wchar_t*)payload->Data;
-                            component.Texture = Texture2D::Create(path);
+                            component.Texture = AssetManager::LoadTexture(path);
                         }
                         ImGui::EndDragDropTarget();
                     }
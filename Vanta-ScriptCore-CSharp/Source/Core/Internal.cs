@@ -40,6 +40,9 @@ namespace Vanta {
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static void TransformComponent_SetPosition(UUID entityID, ref Vector3 position);
 
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void SpriteComponent_SetTexture(UUID entityID, string path);
+
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(UUID entityID, ref Vector2 impulse, bool wake);
     }
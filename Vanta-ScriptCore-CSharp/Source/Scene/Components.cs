@@ -29,7 +29,15 @@ namespace Vanta {
     public class BoxCollider2DComponent : Component {}
     public class CircleCollider2DComponent : Component {}
 
-    public class SpriteComponent : Component {}
+    public class SpriteComponent : Component {
+
+        // Path is relative to the project's asset directory.
+        // Sprites using the same file share one texture.
+        public void SetTexture(string path) {
+            Internal.SpriteComponent_SetTexture(Entity.ID, path);
+        }
+    }
+
     public class CircleRendererComponent : Component {}
 
     public class CameraComponent : Component {}
@@ -22,6 +22,7 @@ namespace Vanta {
             void (*TransformComponent_SetPosition) (uint64, const Vector3&);
 
             void (*SpriteComponent_SetColor) (uint64, const Vector4&);
+            void (*SpriteComponent_SetTexture) (uint64, const char*);
 
             void (*Rigidbody2DComponent_ApplyLinearImpulseToCenter) (uint64, const Vector2&, bool);
         };
@@ -61,6 +61,12 @@ namespace Vanta {
         void SetColor(const Vector4& value) {
             return Internal.SpriteComponent_SetColor(m_EntityID, value);
         }
+
+        /// Path is relative to the project's asset directory.
+        /// Sprites using the same file share one texture.
+        void SetTexture(const char* path) {
+            return Internal.SpriteComponent_SetTexture(m_EntityID, path);
+        }
     };
 
     struct CircleRendererComponent : public Component {
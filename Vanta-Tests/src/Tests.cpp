@@ -56,21 +56,18 @@ namespace Testing {
     bool TestFibers() {
         Fibers::Init();
 
-        Ref<std::atomic_int> number = NewRef<std::atomic_int>(1);
+        std::atomic_int number = 1;
 
-        ParallelBarrier barrier;
-        barrier.StartFibers(50);
+        auto job = [&number](usize index) {
+            const int id = (int)index + 1;
+            for (int j = 1; j < id; j++) {
+                number = (j % 2 == 0) ? (number * j) : (number + j);
+                this_fiber::yield();
+            }
+        };
 
-        for (int i = 1; i <= 50; i++) {
-            Fibers::Spawn([](int id, ParallelBarrier* barrier, Ref<std::atomic_int> num) {
-                for (int j = 1; j < id; j++) {
-                    auto x = *num = (j % 2 == 0) ? (*num * j) : (*num + j);
-                    //VANTA_CORE_INFO("[{}] {}", id, x);
-                    this_fiber::yield();
-                }
-            barrier->WaitFiber();
-            }, i, &barrier, number);
-        }
+        JobCounter counter;
+        Fibers::Dispatch(counter, 50, job);
 
         int linear = 1;
         for (int i = 1; i <= 50; i++) {
@@ -80,9 +77,9 @@ namespace Testing {
             }
         }
 
-        barrier.Wait();
+        counter.Wait();
 
-        TRUE_OR_FAIL(*number != linear);
+        TRUE_OR_FAIL(number != linear);
 
         Fibers::Shutdown();
         return true;
@@ -0,0 +1,85 @@
+#include <vanta-test-utils/CoreTestsCommon.hpp>
+
+namespace Testing {
+
+    // Small binary PPM, so the tests don't depend on image files on disk
+    static Path WriteTestImage(const std::string& name) {
+        const Path path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n2 2\n255\n";
+        const unsigned char pixels[12] = { 255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255 };
+        file.write(reinterpret_cast<const char*>(pixels), sizeof(pixels));
+        return path;
+    }
+
+    bool TestAssetManagerSharesTextures() {
+        const Path circle = WriteTestImage("Vanta-Tests-Circle.ppm");
+        const Path square = WriteTestImage("Vanta-Tests-Square.ppm");
+        const usize baseline = AssetManager::GetTextureCount();
+
+        // Every sprite using a file gets the same texture
+        std::vector<Ref<Texture2D>> sprites;
+        for (usize i = 0; i < 100; i++)
+            sprites.push_back(AssetManager::GetTexture(circle));
+        TRUE_OR_FAIL(std::all_of(sprites.begin(), sprites.end(), [&](const auto& tex) { return tex.get() == sprites[0].get(); }));
+
+        // Paths that lead to the same file share too
+        const Path directory = circle.parent_path();
+        auto roundabout = AssetManager::GetTexture(directory / ".." / directory.filename() / circle.filename());
+        TRUE_OR_FAIL(roundabout.get() == sprites[0].get());
+
+        auto other = AssetManager::GetTexture(square);
+        TRUE_OR_FAIL(other.get() != sprites[0].get());
+        TRUE_OR_FAIL(AssetManager::GetTextureCount() == baseline + 2);
+
+        std::filesystem::remove(circle);
+        std::filesystem::remove(square);
+        return true;
+    }
+
+    bool TestAssetManagerEvictsUnusedTextures() {
+        const Path path = WriteTestImage("Vanta-Tests-Evicted.ppm");
+        const usize baseline = AssetManager::GetTextureCount();
+
+        auto texture = AssetManager::GetTexture(path);
+        const uint32 firstID = texture->GetRendererID();
+        TRUE_OR_FAIL(AssetManager::FindTexture(path) == texture);
+        TRUE_OR_FAIL(AssetManager::GetTextureCount() == baseline + 1);
+
+        // Once no one holds the texture, it's freed rather than kept around
+        texture = nullptr;
+        TRUE_OR_FAIL(AssetManager::FindTexture(path) == nullptr);
+        AssetManager::Collect();
+        TRUE_OR_FAIL(AssetManager::GetTextureCount() == baseline);
+
+        // And loaded again when next needed
+        texture = AssetManager::GetTexture(path);
+        TRUE_OR_FAIL(texture->GetRendererID() != firstID);
+
+        texture = nullptr;
+        std::filesystem::remove(path);
+        return true;
+    }
+
+    bool TestAssetManagerLoadsAsynchronously() {
+        const Path path = WriteTestImage("Vanta-Tests-AsyncLoad.ppm");
+
+        // A placeholder is handed out right away, and shared while the image loads
+        auto texture = AssetManager::LoadTexture(path);
+        const uint32 placeholderRevision = texture->GetRevision();
+        TRUE_OR_FAIL(texture->GetWidth() == 1 && texture->GetHeight() == 1);
+        TRUE_OR_FAIL(AssetManager::LoadTexture(path) == texture);
+        TRUE_OR_FAIL(texture->GetPath() == AssetManager::GetKey(path));
+
+        // Once uploaded, the same texture holds the image
+        AssetManager::FinishLoading();
+        TRUE_OR_FAIL(AssetManager::GetLoadingCount() == 0);
+        TRUE_OR_FAIL(texture->GetWidth() == 2 && texture->GetHeight() == 2);
+        TRUE_OR_FAIL(texture->GetRevision() != placeholderRevision);
+        TRUE_OR_FAIL(AssetManager::FindTexture(path) == texture);
+
+        texture = nullptr;
+        std::filesystem::remove(path);
+        return true;
+    }
+}
@@ -7,7 +7,12 @@
 #include "Scene/SceneRegistry.cpp"
 #include "Project/Project.cpp"
 #include "Scene/TransformCommandQueue.cpp"
+#include "Scene/BinarySerializer.cpp"
+#include "Scene/Serializer.cpp"
 #include "Scripts/CSharp.cpp"
+#include "Render/Headless.cpp"
+#include "Render/RenderQueue.cpp"
+#include "Asset/AssetManager.cpp"
 
 using namespace Testing;
 
@@ -20,16 +25,37 @@ int main(int argc, char** argv) {
     engineParams.Window.Title = "Vanta-Tests";
     engineParams.Window.Width = 1;
     engineParams.Window.Height = 1;
+    engineParams.Headless = true;
     Engine engine(engineParams);
 
     TestSet testMath("Math", { { "MathDecompose", TestMathDecompose } });
-    TestSet testFibers("Fibers", { { "Fibers", TestFibers } });
+    TestSet testFibers("Fibers", {
+        { "Fibers", TestFibers },
+        { "JobsFromManyThreads", TestJobsFromManyThreads },
+        { "ParallelView", TestParallelView },
+        { "ParallelBarrierReusesStorage", TestParallelBarrierReusesStorage },
+    });
     TestSet testEvents("Events", { { "Events", TestEvents } });
     TestSet testSceneRegistry("SceneRegistry", {
         { "BasicOperations", TestSceneRegistryBasics },
         { "ReplacementSemantics", TestSceneRegistryReplacementSemantics },
         { "TransformCommandsApplyByPhase", TestSceneTransformCommandsApplyByPhase },
         { "FlushClearsPendingCommands", TestSceneFlushClearsPendingCommands },
+        { "PhysicsWritesBackMovedBodies", TestScenePhysicsWritesBackMovedBodies },
+        { "FixedTimestep", TestSceneFixedTimestep },
+        { "PhysicsWorkersDeterministic", TestScenePhysicsWorkersDeterministic },
+    });
+
+    TestSet testSceneSerializer("SceneSerializer", {
+        { "ReadsSingleKeys", TestSceneSerializerReadsSingleKeys },
+        { "ReadsSingleEntities", TestSceneSerializerReadsSingleEntities },
+        { "FailsOnBrokenEntity", TestSceneSerializerFailsOnBrokenEntity },
+        { "LoadsInParallel", TestSceneSerializerLoadsInParallel },
+    });
+
+    TestSet testBinaryScene("BinaryScene", {
+        { "RoundTrip", TestBinarySceneRoundTrip },
+        { "RejectsOtherVersions", TestBinarySceneRejectsOtherVersions },
     });
 
     TestSet testProjectScaffolding("ProjectScaffolding", { { "ScriptProjectScaffolding", TestScriptProjectScaffolding } });
@@ -47,6 +73,13 @@ int main(int argc, char** argv) {
         { "MultiEntityOrderingIsStable",     MultiEntityOrderingIsStable     },
         { "SetTransformAppliesAllFields",    SetTransformAppliesAllFields    },
         { "DiagnosticsAccumulateAndReset",   DiagnosticsAccumulateAndReset   },
+        { "ConcurrentEnqueueFromThreads",    ConcurrentEnqueueFromThreads    },
+        { "PhaseBucketsApplyIndependently",  PhaseBucketsApplyIndependently  },
+        { "CoalescesCommandsPerEntity",      CoalescesCommandsPerEntity      },
+        { "InOrderModeMatchesCoalesced",     InOrderModeMatchesCoalesced     },
+        { "ParallelApplyLargeBatch",         ParallelApplyLargeBatch         },
+        { "MoreProducersThanSlots",          MoreProducersThanSlots          },
+        { "SameEntityMergeFollowsSequence",  SameEntityMergeFollowsSequence  },
     });
 
     TestSet testCSharpScripts("CSharpScripts", {
@@ -54,11 +87,47 @@ int main(int argc, char** argv) {
         { "PlayerLifecycleWithoutOnDestroy", TestCSharpPlayerLifecycleWithoutOnDestroy },
     });
 
+    TestSet testHeadless("Headless", {
+        { "NullWindow",             TestHeadlessWindow                 },
+        { "RecordsDrawSubmissions", TestHeadlessRecordsDrawSubmissions },
+        { "QuadListMatchesImmediateDraws", TestHeadlessQuadListMatchesImmediateDraws },
+        { "SceneExtractsSprites", TestHeadlessSceneExtractsSprites },
+        { "TexturesShareBatch", TestHeadlessTexturesShareBatch },
+        { "TextureArrayReusesLayers", TestHeadlessTextureArrayReusesLayers },
+        { "TextureArrayDirectPages", TestHeadlessTextureArrayDirectPages },
+        { "TextureSortKeys", TestHeadlessTextureSortKeys },
+        { "StreamingBufferRing", TestHeadlessStreamingBufferRing },
+        { "SceneOrdersTranslucentDraws", TestHeadlessSceneOrdersTranslucentDraws },
+        { "SceneCullsOffscreenDraws", TestHeadlessSceneCullsOffscreenDraws },
+        { "SceneCachesStaticSprites", TestHeadlessSceneCachesStaticSprites },
+        { "SceneMergesStaticChunks", TestHeadlessSceneMergesStaticChunks },
+        { "QuadKeepsTilt", TestHeadlessQuadKeepsTilt },
+        { "PackedVertexLayout", TestHeadlessPackedVertexLayout },
+        { "FramebufferReadback", TestHeadlessFramebufferReadback },
+        { "IndirectSubmission", TestHeadlessIndirectSubmission },
+    });
+
+    TestSet testRenderQueue("RenderQueue", {
+        { "SortIsStable", TestRenderQueueSortIsStable },
+        { "KeyOrder", TestRenderQueueKeyOrder },
+    });
+
+    TestSet testAssetManager("AssetManager", {
+        { "SharesTextures", TestAssetManagerSharesTextures },
+        { "EvictsUnusedTextures", TestAssetManagerEvictsUnusedTextures },
+        { "LoadsAsynchronously", TestAssetManagerLoadsAsynchronously },
+    });
+
     return (testMath.IsGood()
         && testFibers.IsGood()
         && testEvents.IsGood()
         && testSceneRegistry.IsGood()
+        && testSceneSerializer.IsGood()
+        && testBinaryScene.IsGood()
         && testProjectScaffolding.IsGood()
         && testCommandQueue.IsGood()
-        && testCSharpScripts.IsGood()) ? 0 : 1;
+        && testCSharpScripts.IsGood()
+        && testHeadless.IsGood()
+        && testRenderQueue.IsGood()
+        && testAssetManager.IsGood()) ? 0 : 1;
 }
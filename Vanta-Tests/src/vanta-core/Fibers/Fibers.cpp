@@ -5,20 +5,18 @@ namespace Testing {
     bool TestFibers() {
         Fibers::Init();
 
-        Ref<std::atomic_int> number = NewRef<std::atomic_int>(1);
+        std::atomic_int number = 1;
 
-        ParallelBarrier barrier;
-        barrier.StartFibers(50);
+        auto job = [&number](usize index) {
+            const int id = (int)index + 1;
+            for (int j = 1; j < id; j++) {
+                number = (j % 2 == 0) ? (number * j) : (number + j);
+                this_fiber::yield();
+            }
+        };
 
-        for (int i = 1; i <= 50; i++) {
-            Fibers::Spawn([](int id, ParallelBarrier* barrier, Ref<std::atomic_int> num) {
-                for (int j = 1; j < id; j++) {
-                    auto x = *num = (j % 2 == 0) ? (*num * j) : (*num + j);
-                    this_fiber::yield();
-                }
-                barrier->WaitFiber();
-            }, i, &barrier, number);
-        }
+        JobCounter counter;
+        Fibers::Dispatch(counter, 50, job);
 
         int linear = 1;
         for (int i = 1; i <= 50; i++) {
@@ -27,11 +25,102 @@ namespace Testing {
             }
         }
 
-        barrier.Wait();
+        counter.Wait();
 
-        TRUE_OR_FAIL(*number != linear);
+        TRUE_OR_FAIL(counter.IsDone());
+        TRUE_OR_FAIL(number != linear);
 
         Fibers::Shutdown();
         return true;
     }
+
+    bool TestJobsFromManyThreads() {
+        static constexpr usize THREADS = 4;
+        static constexpr usize ROUNDS = 50;
+        static constexpr usize JOBS = 8;
+
+        std::atomic<usize> total = 0;
+
+        // Jobs that dispatch and wait on jobs of their own, from threads outside the fiber pool
+        std::vector<std::thread> threads;
+        for (usize t = 0; t < THREADS; t++) {
+            threads.emplace_back([&total]() {
+                auto inner = [&total](usize) { total.fetch_add(1, std::memory_order_relaxed); };
+                auto outer = [&inner](usize) {
+                    JobCounter counter;
+                    Fibers::Dispatch(counter, JOBS, inner);
+                    counter.Wait();
+                };
+
+                for (usize r = 0; r < ROUNDS; r++) {
+                    JobCounter counter;
+                    Fibers::Dispatch(counter, JOBS, outer);
+                    counter.Wait();
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        TRUE_OR_FAIL(total == THREADS * ROUNDS * JOBS * JOBS);
+        return true;
+    }
+
+    bool TestParallelView() {
+        static constexpr usize ENTITY_COUNT = 20000;
+
+        SceneRegistry reg;
+        for (usize i = 0; i < ENTITY_COUNT; i++) {
+            auto entity = reg.Create();
+            reg.AddComponent<TransformComponent>(entity);
+            if (i % 3 == 0)
+                reg.AddComponent<CircleRendererComponent>(entity);
+        }
+
+        // Single component: every entity is visited exactly once
+        std::atomic<usize> visited = 0;
+        ParallelBarrier barrier;
+        ParallelView<TransformComponent>(barrier, reg, [&visited](entt::entity, TransformComponent& tc) {
+            tc.SetPosition(tc.GetPosition() + glm::vec3(1.f, 0.f, 0.f));
+            visited.fetch_add(1, std::memory_order_relaxed);
+        });
+        barrier.Wait();
+
+        TRUE_OR_FAIL(visited == ENTITY_COUNT);
+        for (auto entity : reg.View<TransformComponent>())
+            TRUE_OR_FAIL(reg.GetComponent<TransformComponent>(entity).GetPosition().x == 1.f);
+
+        // Multiple components: only entities with all of them are visited
+        visited = 0;
+        ParallelView<TransformComponent, CircleRendererComponent>(barrier, reg, [&visited](entt::entity, TransformComponent&, CircleRendererComponent&) {
+            visited.fetch_add(1, std::memory_order_relaxed);
+        });
+        barrier.Wait();
+
+        TRUE_OR_FAIL(visited == (ENTITY_COUNT + 2) / 3);
+        return true;
+    }
+
+    bool TestParallelBarrierReusesStorage() {
+        struct State {
+            int& Destroyed;
+            State(int& destroyed) : Destroyed(destroyed) {}
+            ~State() { Destroyed++; }
+        };
+
+        int destroyed = 0;
+        ParallelBarrier barrier;
+        State* first = &barrier.Emplace<State>(destroyed);
+        barrier.Emplace<State>(destroyed);
+        barrier.Wait();
+        TRUE_OR_FAIL(destroyed == 2);
+
+        // Storage is handed out again from the start after every wait
+        for (int i = 0; i < 4; i++) {
+            TRUE_OR_FAIL(&barrier.Emplace<State>(destroyed) == first);
+            barrier.Wait();
+        }
+        TRUE_OR_FAIL(destroyed == 6);
+        return true;
+    }
 }
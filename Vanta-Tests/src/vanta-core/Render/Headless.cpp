@@ -0,0 +1,576 @@
+#include <vanta-test-utils/CoreTestsCommon.hpp>
+#include <Platform/Null/GraphicsAPI.hpp>
+#include <Vanta/Render/TextureArrayCache.hpp>
+#include <Vanta/Render/Framebuffer.hpp>
+
+namespace Testing {
+
+    bool TestHeadlessWindow() {
+        TRUE_OR_FAIL(Engine::Get().IsHeadless());
+        TRUE_OR_FAIL(GraphicsAPI::GetAPI() == GraphicsAPI::None);
+        TRUE_OR_FAIL(Engine::Get().GetWindow().GetNativeWindow() == nullptr);
+        TRUE_OR_FAIL(Engine::Get().GetGUILayer() == nullptr);
+        return true;
+    }
+
+    bool TestHeadlessRecordsDrawSubmissions() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        auto camera = SceneCamera::Orthographic();
+        Renderer2D::SceneBegin(&camera);
+        Renderer2D::DrawQuad(glm::vec2{ 0.f, 0.f }, glm::vec2{ 1.f, 1.f }, glm::vec4{ 1.f });
+        Renderer2D::DrawQuad(glm::vec2{ 2.f, 0.f }, glm::vec2{ 1.f, 1.f }, glm::vec4{ 1.f });
+        Renderer2D::DrawLine(glm::vec3{ 0.f }, glm::vec3{ 1.f }, glm::vec4{ 1.f });
+        Renderer2D::SceneEnd();
+
+        const auto& submissions = api.GetSubmissions();
+        TRUE_OR_FAIL(submissions.DrawIndexedCalls == 0);
+        TRUE_OR_FAIL(submissions.DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(submissions.InstanceCount == 2);
+        TRUE_OR_FAIL(submissions.IndexCount == 2 * 6);
+        TRUE_OR_FAIL(submissions.DrawLinesCalls == 1);
+        TRUE_OR_FAIL(submissions.LineVertexCount == 2);
+        TRUE_OR_FAIL(Renderer2D::GetStats().QuadCount == 2);
+        TRUE_OR_FAIL(Renderer2D::GetStats().InstanceCount == 2);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessQuadListMatchesImmediateDraws() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        auto camera = SceneCamera::Orthographic();
+
+        // More quads than fit in one batch
+        static constexpr usize QUAD_COUNT = 10000;
+
+        auto draw = [&](bool list) {
+            Renderer2D::FrameEnd();
+            api.ResetSubmissions();
+            Renderer2D::ResetStats();
+
+            QuadList quads;
+            Renderer2D::SceneBegin(&camera);
+            for (usize i = 0; i < QUAD_COUNT; i++) {
+                glm::mat4 transform = glm::translate(glm::mat4(1.f), glm::vec3((float)i, 0.f, 0.f));
+                if (list)
+                    quads.Add(transform, glm::vec4(1.f), (int)i);
+                else
+                    Renderer2D::DrawQuad(transform, glm::vec4(1.f), (int)i);
+            }
+            Renderer2D::DrawQuads(quads);
+            Renderer2D::SceneEnd();
+
+            return std::make_pair(api.GetSubmissions(), Renderer2D::GetStats());
+        };
+
+        const auto [immediate, immediateStats] = draw(false);
+        const auto [listed, listedStats] = draw(true);
+
+        TRUE_OR_FAIL(immediate.DrawIndexedInstancedCalls == 2);
+        TRUE_OR_FAIL(listed.DrawIndexedInstancedCalls == immediate.DrawIndexedInstancedCalls);
+        TRUE_OR_FAIL(listed.InstanceCount == QUAD_COUNT);
+        TRUE_OR_FAIL(listedStats.InstanceCount == immediateStats.InstanceCount);
+        TRUE_OR_FAIL(listedStats.DrawCalls == immediateStats.DrawCalls);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessSceneExtractsSprites() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        // Enough sprites to be extracted by several jobs
+        static constexpr usize SPRITE_COUNT = 5000;
+
+        Scene scene;
+        for (usize i = 0; i < SPRITE_COUNT; i++) {
+            auto entity = scene.CreateEntity("Sprite");
+            entity.GetComponent<TransformComponent>().SetPosition({ (float)(i % 8) * 0.5f, 0.f, 0.f });
+            entity.AddComponent<SpriteComponent>(glm::vec4(1.f));
+        }
+
+        auto camera = SceneCamera::Orthographic();
+        scene.OnUpdateEditor(0.0, &camera);
+
+        TRUE_OR_FAIL(api.GetSubmissions().DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(api.GetSubmissions().InstanceCount == SPRITE_COUNT);
+        TRUE_OR_FAIL(Renderer2D::GetStats().InstanceCount == SPRITE_COUNT);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessTexturesShareBatch() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        // Far more textures than there are texture slots, in a couple of sizes
+        static constexpr usize TEXTURE_COUNT = 100;
+
+        std::vector<Ref<Texture2D>> textures;
+        for (usize i = 0; i < TEXTURE_COUNT; i++) {
+            const uint32 size = (i % 2 == 0) ? 16 : 32;
+            textures.push_back(Texture2D::Create(size, size));
+        }
+
+        auto camera = SceneCamera::Orthographic();
+        Renderer2D::SceneBegin(&camera);
+        for (usize i = 0; i < TEXTURE_COUNT; i++) {
+            glm::mat4 transform = glm::translate(glm::mat4(1.f), glm::vec3((float)i, 0.f, 0.f));
+            Renderer2D::DrawQuad(transform, textures[i]);
+        }
+        Renderer2D::SceneEnd();
+
+        TRUE_OR_FAIL(api.GetSubmissions().DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(api.GetSubmissions().InstanceCount == TEXTURE_COUNT);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessTextureArrayReusesLayers() {
+        static constexpr usize TEXTURE_COUNT = 10;
+
+        TextureArrayCache cache;
+
+        // Placing a texture again finds the same layer
+        auto first = Texture2D::Create(8, 8);
+        const TextureLocation location = cache.Place(first);
+        TRUE_OR_FAIL(cache.Place(first).Page == location.Page);
+        TRUE_OR_FAIL(cache.Place(first).Layer == location.Layer);
+
+        // The first texture of a size is viewed directly, the ones after it share a page
+        TRUE_OR_FAIL(cache.GetArray(location.Page)->GetLayerCount() == 1);
+        first = nullptr;
+
+        // Layers of destroyed textures are reused before the page grows past what's alive at once
+        Opt<uint32> sharedPage;
+        for (usize round = 0; round < 5; round++) {
+            std::vector<Ref<Texture2D>> textures;
+            for (usize i = 0; i < TEXTURE_COUNT; i++) {
+                textures.push_back(Texture2D::Create(8, 8));
+                const TextureLocation loc = cache.Place(textures.back());
+                if (!sharedPage)
+                    sharedPage = loc.Page;
+                TRUE_OR_FAIL(loc.Page == *sharedPage);
+                TRUE_OR_FAIL(loc.Page != location.Page);
+                TRUE_OR_FAIL(loc.Layer < 16);
+            }
+        }
+        TRUE_OR_FAIL(cache.GetPageCount() == 2);
+        TRUE_OR_FAIL(cache.GetArray(*sharedPage)->GetLayerCount() == 16);
+
+        // Other sizes get their own page, taking over the view of the destroyed texture
+        auto other = Texture2D::Create(4, 4);
+        TRUE_OR_FAIL(cache.Place(other).Page == location.Page);
+        TRUE_OR_FAIL(cache.GetPageCount() == 2);
+        return true;
+    }
+
+    bool TestHeadlessTextureArrayDirectPages() {
+        TextureArrayCache cache;
+
+        // Large textures are never copied into a shared page, even when their size repeats
+        auto first = Texture2D::Create(TextureArrayCache::DIRECT_SIZE, TextureArrayCache::DIRECT_SIZE);
+        auto second = Texture2D::Create(TextureArrayCache::DIRECT_SIZE, TextureArrayCache::DIRECT_SIZE);
+        const TextureLocation firstLoc = cache.Place(first);
+        const TextureLocation secondLoc = cache.Place(second);
+        TRUE_OR_FAIL(firstLoc.Page != secondLoc.Page);
+        TRUE_OR_FAIL(firstLoc.Layer == 0 && secondLoc.Layer == 0);
+        TRUE_OR_FAIL(cache.GetArray(firstLoc.Page)->GetLayerCount() == 1);
+        TRUE_OR_FAIL(cache.GetArray(secondLoc.Page)->GetLayerCount() == 1);
+
+        // The page of a destroyed texture is given to the next one that needs it
+        first = nullptr;
+        auto third = Texture2D::Create(TextureArrayCache::DIRECT_SIZE, TextureArrayCache::DIRECT_SIZE);
+        TRUE_OR_FAIL(cache.Place(third).Page == firstLoc.Page);
+        TRUE_OR_FAIL(cache.GetPageCount() == 2);
+        TRUE_OR_FAIL(cache.GetTextureCount() == 2);
+        return true;
+    }
+
+    bool TestHeadlessTextureSortKeys() {
+        auto camera = SceneCamera::Orthographic();
+
+        // The first texture of a size gets a page of its own, the ones after it share one.
+        // The size is one no other test draws with.
+        auto first = Texture2D::Create(24, 40);
+        auto second = Texture2D::Create(24, 40);
+        auto third = Texture2D::Create(24, 40);
+        auto undrawn = Texture2D::Create(24, 40);
+
+        Renderer2D::SceneBegin(&camera);
+        Renderer2D::DrawQuad(glm::mat4(1.f), first);
+        Renderer2D::DrawQuad(glm::mat4(1.f), second);
+        Renderer2D::DrawQuad(glm::mat4(1.f), third);
+        Renderer2D::SceneEnd();
+
+        // Textures sort by the page they're bound through, not by their own ID
+        TRUE_OR_FAIL(Renderer2D::GetTextureSortKey(second.get()) == Renderer2D::GetTextureSortKey(third.get()));
+        TRUE_OR_FAIL(Renderer2D::GetTextureSortKey(first.get()) != Renderer2D::GetTextureSortKey(second.get()));
+
+        // Textures without a page yet are kept apart from every page
+        const uint32 unplaced = 1u << (RenderQueue::TEXTURE_BITS - 1);
+        TRUE_OR_FAIL(Renderer2D::GetTextureSortKey(undrawn.get()) >= unplaced);
+        TRUE_OR_FAIL(Renderer2D::GetTextureSortKey(second.get()) < unplaced);
+        TRUE_OR_FAIL(Renderer2D::GetTextureSortKey(nullptr) < unplaced);
+
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessStreamingBufferRing() {
+        static constexpr usize STRIDE = 16;
+        static constexpr usize REGION_SIZE = 64 * STRIDE;
+
+        auto buffer = StreamingVertexBuffer::Create(REGION_SIZE, 3);
+        buffer->SetLayout({ { Shader::DataType::Float4, "aValue" } });
+
+        // Writes append within a region, aligned to whole vertices
+        uint8* first = (uint8*)buffer->Map(REGION_SIZE / 2);
+        TRUE_OR_FAIL(buffer->Commit(10 * STRIDE) == 0);
+        uint8* second = (uint8*)buffer->Map(REGION_SIZE / 2);
+        TRUE_OR_FAIL(second == first + 10 * STRIDE);
+        TRUE_OR_FAIL(buffer->Commit(STRIDE / 2) == 10);
+        TRUE_OR_FAIL(buffer->GetRegion() == 0);
+
+        // Everything left in the region is mapped
+        buffer->Map(STRIDE);
+        TRUE_OR_FAIL(buffer->GetMappedSize() == REGION_SIZE - 11 * STRIDE);
+        TRUE_OR_FAIL(buffer->Commit(0) == 11);
+
+        // Moves on to the next region once one is full, and wraps around
+        buffer->Map(REGION_SIZE);
+        TRUE_OR_FAIL(buffer->GetRegion() == 1);
+        TRUE_OR_FAIL(buffer->Commit(REGION_SIZE) == REGION_SIZE / STRIDE);
+
+        buffer->Map(STRIDE);
+        TRUE_OR_FAIL(buffer->GetRegion() == 2);
+        TRUE_OR_FAIL(buffer->Commit(STRIDE) == 2 * REGION_SIZE / STRIDE);
+
+        buffer->Map(REGION_SIZE);
+        TRUE_OR_FAIL(buffer->GetRegion() == 0);
+        TRUE_OR_FAIL(buffer->Commit(0) == 0);
+
+        // The end of a frame moves on to the next region, however little was written
+        buffer->NextFrame();
+        buffer->Map(STRIDE);
+        TRUE_OR_FAIL(buffer->GetRegion() == 1);
+        TRUE_OR_FAIL(buffer->Commit(STRIDE) == REGION_SIZE / STRIDE);
+        return true;
+    }
+
+    bool TestHeadlessSceneOrdersTranslucentDraws() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        auto camera = SceneCamera::Orthographic();
+
+        static constexpr usize PAIR_COUNT = 8;
+
+        auto draw = [&](bool layered) {
+            Renderer2D::FrameEnd();
+            api.ResetSubmissions();
+            Renderer2D::ResetStats();
+
+            // Translucent sprites and circles, interleaved in depth when layered
+            Scene scene;
+            for (usize i = 0; i < PAIR_COUNT; i++) {
+                auto sprite = scene.CreateEntity("Sprite");
+                sprite.GetComponent<TransformComponent>().SetPosition({ 0.f, 0.f, layered ? (float)(2 * i) * 0.01f : 0.f });
+                sprite.AddComponent<SpriteComponent>(glm::vec4(1.f, 1.f, 1.f, 0.5f));
+
+                auto circle = scene.CreateEntity("Circle");
+                circle.GetComponent<TransformComponent>().SetPosition({ 0.f, 0.f, layered ? (float)(2 * i + 1) * 0.01f : 0.f });
+                circle.AddComponent<CircleRendererComponent>();
+            }
+
+            scene.OnUpdateEditor(0.0, &camera);
+            return api.GetSubmissions();
+        };
+
+        // Alternating depths need every draw flushed in turn to blend in order
+        const auto layered = draw(true);
+        TRUE_OR_FAIL(layered.DrawIndexedInstancedCalls == PAIR_COUNT);
+        TRUE_OR_FAIL(layered.DrawIndexedCalls == PAIR_COUNT);
+
+        // At equal depth, draws are grouped by shader instead
+        const auto flat = draw(false);
+        TRUE_OR_FAIL(flat.DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(flat.DrawIndexedCalls == 1);
+        TRUE_OR_FAIL(flat.InstanceCount == PAIR_COUNT);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessSceneCullsOffscreenDraws() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        // Orthographic size 10 sees about 5 units above and below the origin
+        static constexpr usize ROW_COUNT = 4000;
+
+        Scene scene;
+        for (usize i = 0; i < ROW_COUNT; i++) {
+            // One sprite on screen and one far off screen, above it
+            const float x = (float)(i % 8) * 0.5f;
+
+            auto visible = scene.CreateEntity("Visible");
+            visible.GetComponent<TransformComponent>().SetPosition({ x, 0.f, 0.f });
+            visible.AddComponent<SpriteComponent>(glm::vec4(1.f));
+
+            auto offscreen = scene.CreateEntity("Offscreen");
+            offscreen.GetComponent<TransformComponent>().SetPosition({ x, 100.f, 0.f });
+            offscreen.AddComponent<SpriteComponent>(glm::vec4(1.f));
+        }
+
+        // A large circle reaching into view from off screen is kept
+        auto circle = scene.CreateEntity("Circle");
+        circle.GetComponent<TransformComponent>().SetPosition({ 0.f, 10.f, 0.f });
+        circle.GetComponent<TransformComponent>().SetScale({ 12.f, 12.f, 1.f });
+        circle.AddComponent<CircleRendererComponent>();
+
+        auto camera = SceneCamera::Orthographic();
+        scene.OnUpdateEditor(0.0, &camera);
+
+        const auto stats = Renderer2D::GetStats();
+        TRUE_OR_FAIL(stats.VisibleCount == ROW_COUNT + 1);
+        TRUE_OR_FAIL(stats.CulledCount == ROW_COUNT);
+        TRUE_OR_FAIL(stats.InstanceCount == ROW_COUNT);
+        TRUE_OR_FAIL(api.GetSubmissions().DrawIndexedCalls == 1);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessSceneCachesStaticSprites() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        auto camera = SceneCamera::Orthographic();
+
+        // More static sprites than fit in one chunk, and a sprite on a rigidbody, which is never cached
+        static constexpr usize SPRITE_COUNT = 3000;
+        static constexpr usize CHUNK_COUNT = (SPRITE_COUNT + StaticSpriteCache::CHUNK_SIZE - 1) / StaticSpriteCache::CHUNK_SIZE;
+
+        Scene scene;
+        std::vector<Entity> sprites;
+        for (usize i = 0; i < SPRITE_COUNT; i++) {
+            auto entity = scene.CreateEntity("Sprite");
+            entity.GetComponent<TransformComponent>().SetPosition({ (float)(i % 8) * 0.5f, 0.f, 0.f });
+            entity.AddComponent<SpriteComponent>(glm::vec4(1.f));
+            sprites.push_back(entity);
+        }
+
+        auto body = scene.CreateEntity("Body");
+        body.AddComponent<SpriteComponent>(glm::vec4(1.f));
+        body.AddComponent<Rigidbody2DComponent>();
+
+        auto render = [&](usize frames) {
+            for (usize i = 0; i < frames; i++) {
+                Renderer2D::FrameEnd();
+                api.ResetSubmissions();
+                Renderer2D::ResetStats();
+                scene.OnUpdateEditor(0.0, &camera);
+            }
+            return api.GetSubmissions();
+        };
+
+        // Once settled, every chunk is a single draw, besides the batch of the rigidbody's sprite
+        auto settled = render(StaticSpriteCache::SETTLE_FRAMES + 2);
+        TRUE_OR_FAIL(settled.DrawIndexedInstancedCalls == CHUNK_COUNT + 1);
+        TRUE_OR_FAIL(settled.InstanceCount == SPRITE_COUNT + 1);
+
+        // A moved sprite leaves its chunk, and is culled on its own
+        sprites[0].GetComponent<TransformComponent>().SetPosition({ 0.f, 100.f, 0.f });
+        auto moved = render(1);
+        TRUE_OR_FAIL(moved.InstanceCount == SPRITE_COUNT);
+        TRUE_OR_FAIL(Renderer2D::GetStats().CulledCount == 1);
+
+        // Once it settles again, it's cached in a chunk of its own, which is culled as a whole
+        moved = render(StaticSpriteCache::SETTLE_FRAMES + 2);
+        TRUE_OR_FAIL(moved.DrawIndexedInstancedCalls == CHUNK_COUNT + 1);
+        TRUE_OR_FAIL(moved.InstanceCount == SPRITE_COUNT);
+        TRUE_OR_FAIL(Renderer2D::GetStats().CulledCount == 1);
+
+        // Destroyed sprites are dropped from their chunks
+        scene.DestroyEntity(sprites[1]);
+        auto destroyed = render(1);
+        TRUE_OR_FAIL(destroyed.InstanceCount == SPRITE_COUNT - 1);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessSceneMergesStaticChunks() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        auto camera = SceneCamera::Orthographic();
+
+        // Sprites added one frame apart settle one frame apart, each on its own
+        static constexpr usize SPRITE_COUNT = 20;
+
+        Scene scene;
+        auto render = [&]() {
+            Renderer2D::FrameEnd();
+            api.ResetSubmissions();
+            Renderer2D::ResetStats();
+            scene.OnUpdateEditor(0.0, &camera);
+            return api.GetSubmissions();
+        };
+
+        for (usize i = 0; i < SPRITE_COUNT; i++) {
+            auto entity = scene.CreateEntity("Sprite");
+            entity.GetComponent<TransformComponent>().SetPosition({ (float)i * 0.1f, 0.f, 0.f });
+            entity.AddComponent<SpriteComponent>(glm::vec4(1.f));
+            render();
+        }
+
+        for (usize i = 0; i < StaticSpriteCache::SETTLE_FRAMES + 2; i++)
+            render();
+
+        // Every new sprite was merged into the chunk already covering its cell
+        auto settled = render();
+        TRUE_OR_FAIL(settled.DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(settled.InstanceCount == SPRITE_COUNT);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessQuadKeepsTilt() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        // Tilted back about X, so the top edge is further away than the bottom
+        const glm::mat4 transform =
+            glm::translate(glm::mat4(1.f), glm::vec3(1.f, 2.f, -3.f)) *
+            glm::rotate(glm::mat4(1.f), glm::radians(60.f), glm::vec3(1.f, 0.f, 0.f)) *
+            glm::scale(glm::mat4(1.f), glm::vec3(2.f, 4.f, 1.f));
+
+        // Expanding the instance the way the vertex shader does lands on the transformed corners
+        QuadInstance instance(transform, glm::vec4(1.f), 1.f, -1);
+        for (const glm::vec2 corner : { glm::vec2(-0.5f, -0.5f), glm::vec2(0.5f, -0.5f), glm::vec2(0.5f, 0.5f), glm::vec2(-0.5f, 0.5f) }) {
+            const glm::vec3 expanded = instance.AxisX * corner.x + instance.AxisY * corner.y + instance.Translation;
+            const glm::vec3 expected = transform * glm::vec4(corner, 0.f, 1.f);
+            TRUE_OR_FAIL(glm::length(expanded - expected) < 1e-5f);
+        }
+        TRUE_OR_FAIL(instance.AxisY.z > 3.f);
+
+        // Tilted quads still take the instanced path
+        auto camera = SceneCamera::Perspective();
+        Renderer2D::SceneBegin(&camera);
+        Renderer2D::DrawQuad(transform, glm::vec4(1.f));
+        Renderer2D::SceneEnd();
+
+        TRUE_OR_FAIL(api.GetSubmissions().DrawIndexedInstancedCalls == 1);
+        TRUE_OR_FAIL(api.GetSubmissions().InstanceCount == 1);
+
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+
+    bool TestHeadlessPackedVertexLayout() {
+        // Packed types take 32 bits however many components they have
+        BufferLayout layout({
+            { Shader::DataType::Float3,    "aPosition" },
+            { Shader::DataType::Half2x16,  "aLocalPosition" },
+            { Shader::DataType::UNorm4x8,  "aColor" },
+            { Shader::DataType::UNorm2x16, "aThicknessFade" },
+        });
+
+        const auto& elements = layout.GetElements();
+        TRUE_OR_FAIL(layout.GetStride() == 24);
+        TRUE_OR_FAIL(elements[1].Offset == 12 && elements[1].Type.ItemCount() == 2);
+        TRUE_OR_FAIL(elements[2].Offset == 16 && elements[2].Type.ItemCount() == 4);
+        TRUE_OR_FAIL(elements[3].Offset == 20 && elements[3].Type.ItemCount() == 2);
+        return true;
+    }
+
+    bool TestHeadlessFramebufferReadback() {
+        FramebufferParams params;
+        params.Width = 64;
+        params.Height = 64;
+        params.Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::RED_INTEGER, FramebufferTextureFormat::Depth };
+        auto framebuffer = Framebuffer::Create(params);
+
+        // Nothing is in flight yet
+        FramebufferReadback readback;
+        TRUE_OR_FAIL(!framebuffer->PollPixels(readback));
+
+        // A whole rectangle comes back in one read
+        TRUE_OR_FAIL(framebuffer->RequestPixels(1, 4, 8, 16, 2));
+        TRUE_OR_FAIL(framebuffer->PollPixels(readback));
+        TRUE_OR_FAIL(readback.X == 4 && readback.Y == 8);
+        TRUE_OR_FAIL(readback.Width == 16 && readback.Height == 2);
+        TRUE_OR_FAIL(readback.Pixels.size() == 32);
+        TRUE_OR_FAIL(readback.Get(15, 1) == -1);
+
+        // Each read is handed out once
+        TRUE_OR_FAIL(!framebuffer->PollPixels(readback));
+        return true;
+    }
+
+    bool TestHeadlessIndirectSubmission() {
+        auto& api = static_cast<NullGraphicsAPI&>(RenderCommand::GetGraphicsAPI());
+        auto camera = SceneCamera::Orthographic();
+        Renderer2D::SetSubmission(Renderer2D::Submission::Indirect);
+
+        // Enough quads for five batches
+        static constexpr usize QUAD_COUNT = 40000;
+
+        Renderer2D::FrameEnd();
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+
+        QuadList quads;
+        for (usize i = 0; i < QUAD_COUNT; i++)
+            quads.Add(glm::translate(glm::mat4(1.f), glm::vec3((float)i, 0.f, 0.f)), glm::vec4(1.f), (int)i);
+
+        Renderer2D::SceneBegin(&camera);
+        Renderer2D::DrawQuads(quads);
+        Renderer2D::SceneEnd();
+
+        // Every batch is a command, and the whole frame's batches share one draw call
+        const auto submissions = api.GetSubmissions();
+        const auto stats = Renderer2D::GetStats();
+        TRUE_OR_FAIL(submissions.DrawIndexedInstancedCalls == 0);
+        TRUE_OR_FAIL(submissions.IndirectDrawCount == 5);
+        TRUE_OR_FAIL(submissions.MultiDrawIndirectCalls == 1);
+        TRUE_OR_FAIL(submissions.InstanceCount == QUAD_COUNT);
+        TRUE_OR_FAIL(stats.BatchCount == 5);
+        TRUE_OR_FAIL(stats.DrawCalls == submissions.MultiDrawIndirectCalls);
+
+        // Recorded quads are drawn before lines, so they stay in order
+        api.ResetSubmissions();
+        Renderer2D::SceneBegin(&camera);
+        Renderer2D::DrawQuad(glm::vec2{ 0.f, 0.f }, glm::vec2{ 1.f, 1.f }, glm::vec4{ 1.f });
+        Renderer2D::DrawLine(glm::vec3{ 0.f }, glm::vec3{ 1.f }, glm::vec4{ 1.f });
+        Renderer2D::SceneEnd();
+        TRUE_OR_FAIL(api.GetSubmissions().MultiDrawIndirectCalls == 1);
+        TRUE_OR_FAIL(api.GetSubmissions().DrawLinesCalls == 1);
+
+        Renderer2D::SetSubmission(Renderer2D::Submission::Immediate);
+        api.ResetSubmissions();
+        Renderer2D::ResetStats();
+        return true;
+    }
+}
@@ -0,0 +1,53 @@
+#include <vanta-test-utils/CoreTestsCommon.hpp>
+#include <Vanta/Render/RenderQueue.hpp>
+
+#include <random>
+
+namespace Testing {
+
+    bool TestRenderQueueSortIsStable() {
+        // Enough draws to be sorted by several jobs
+        static constexpr usize DRAW_COUNT = 100000;
+
+        std::mt19937_64 rng(42);
+        RenderQueue queue;
+        std::vector<RenderQueue::Item> expected;
+        for (usize i = 0; i < DRAW_COUNT; i++) {
+            // Few distinct keys, so plenty of them are equal
+            const uint64 key = rng() & 0xff0000ff0000000full;
+            queue.Push(key, i);
+            expected.push_back({ key, i });
+        }
+
+        queue.Sort();
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.Key < b.Key; });
+
+        TRUE_OR_FAIL(queue.Size() == DRAW_COUNT);
+        for (usize i = 0; i < DRAW_COUNT; i++) {
+            TRUE_OR_FAIL(queue[i].Key == expected[i].Key);
+            TRUE_OR_FAIL(queue[i].Payload == expected[i].Payload);
+        }
+        return true;
+    }
+
+    bool TestRenderQueueKeyOrder() {
+        using Layer = RenderQueue::Layer;
+
+        // Opaque draws group by shader and texture, then go front to back
+        const uint64 opaqueNear = RenderQueue::MakeKey(Layer::Opaque, -0.5f, 1, 3);
+        const uint64 opaqueFar = RenderQueue::MakeKey(Layer::Opaque, 0.5f, 1, 3);
+        const uint64 opaqueOtherShader = RenderQueue::MakeKey(Layer::Opaque, -0.9f, 2, 0);
+        TRUE_OR_FAIL(opaqueNear < opaqueFar);
+        TRUE_OR_FAIL(opaqueFar < opaqueOtherShader);
+
+        // Translucent draws come after opaque ones, back to front
+        const uint64 translucentFar = RenderQueue::MakeKey(Layer::Translucent, 0.9f, 3, 1);
+        const uint64 translucentNear = RenderQueue::MakeKey(Layer::Translucent, -0.9f, 0, 0);
+        TRUE_OR_FAIL(opaqueOtherShader < translucentFar);
+        TRUE_OR_FAIL(translucentFar < translucentNear);
+
+        TRUE_OR_FAIL(RenderQueue::GetLayer(opaqueFar) == Layer::Opaque);
+        TRUE_OR_FAIL(RenderQueue::GetLayer(translucentNear) == Layer::Translucent);
+        return true;
+    }
+}
@@ -0,0 +1,106 @@
+#include <vanta-test-utils/CoreTestsCommon.hpp>
+#include <Vanta/Scene/BinarySerializer.hpp>
+
+namespace Testing {
+
+    bool TestBinarySceneRoundTrip() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-RoundTrip.vntb";
+
+        Ref<Scene> scene = NewRef<Scene>();
+        for (int i = 0; i < 100; i++) {
+            Entity entity = scene->CreateEntity("Sprite " + std::to_string(i));
+            entity.GetComponent<TransformComponent>().SetTransformDeg({ (float)i, 2.f * i, 0.f }, { 0.f, 0.f, 45.f }, { 1.f, 2.f, 1.f });
+
+            auto& sprite = entity.AddComponent<SpriteComponent>(glm::vec4{ 1.f, 0.5f, 0.25f, 1.f });
+            sprite.TilingFactor = 2.f;
+
+            if (i % 4 == 0) {
+                auto& rb = entity.AddComponent<Rigidbody2DComponent>();
+                rb.Type = Rigidbody2DComponent::BodyType::Dynamic;
+                rb.FixedRotation = true;
+                entity.AddComponent<BoxCollider2DComponent>().Size = { 2.f, 3.f };
+            }
+        }
+
+        Entity circle = scene->CreateEntity("Circle");
+        circle.AddComponent<CircleRendererComponent>().Thickness = 0.5f;
+        circle.AddComponent<CircleCollider2DComponent>().Radius = 2.f;
+
+        Entity camera = scene->CreateEntity("Camera");
+        auto& cc = camera.AddComponent<CameraComponent>();
+        cc.Camera->SetOrthographicSize(20.f);
+        cc.FixedAspectRatio = true;
+        scene->SetActiveCameraEntity(camera);
+
+        TRUE_OR_FAIL(BinarySceneSerializer(path).Serialize(scene));
+
+        Ref<Scene> loaded = NewRef<Scene>();
+        TRUE_OR_FAIL(BinarySceneSerializer(path).Deserialize(loaded));
+
+        // Every entity comes back with the same ID, name and components
+        usize count = 0;
+        bool same = true;
+        scene->View<IDComponent>([&](entt::entity handle, IDComponent& id) {
+            count++;
+            Entity original(handle, scene.get());
+            Entity copy = loaded->GetEntityByID(id.ID);
+            if (!copy || copy.GetName() != id.Name) {
+                same = false;
+                return;
+            }
+
+            const auto& a = original.GetComponent<TransformComponent>();
+            const auto& b = copy.GetComponent<TransformComponent>();
+            same &= a.GetPosition() == b.GetPosition() && a.GetRotationRadians() == b.GetRotationRadians() && a.GetScale() == b.GetScale();
+
+            same &= original.HasComponent<SpriteComponent>() == copy.HasComponent<SpriteComponent>();
+            if (copy.HasComponent<SpriteComponent>()) {
+                const auto& sprite = copy.GetComponent<SpriteComponent>();
+                same &= sprite.Color == original.GetComponent<SpriteComponent>().Color && sprite.TilingFactor == 2.f && !sprite.Texture;
+            }
+
+            same &= original.HasComponent<Rigidbody2DComponent>() == copy.HasComponent<Rigidbody2DComponent>();
+            if (copy.HasComponent<Rigidbody2DComponent>()) {
+                const auto& rb = copy.GetComponent<Rigidbody2DComponent>();
+                same &= rb.Type == Rigidbody2DComponent::BodyType::Dynamic && rb.FixedRotation;
+                same &= copy.GetComponent<BoxCollider2DComponent>().Size == glm::vec2{ 2.f, 3.f };
+            }
+        });
+        TRUE_OR_FAIL(same);
+        TRUE_OR_FAIL(count == 102);
+
+        Entity loadedCircle = loaded->GetEntityByID(circle.GetUUID());
+        TRUE_OR_FAIL(loadedCircle.GetComponent<CircleRendererComponent>().Thickness == 0.5f);
+        TRUE_OR_FAIL(loadedCircle.GetComponent<CircleCollider2DComponent>().Radius == 2.f);
+
+        Entity loadedCamera = loaded->GetActiveCameraEntity();
+        TRUE_OR_FAIL(loadedCamera && loadedCamera.GetUUID() == camera.GetUUID());
+        TRUE_OR_FAIL(loadedCamera.GetComponent<CameraComponent>().Camera->GetOrthographicSize() == 20.f);
+        TRUE_OR_FAIL(loadedCamera.GetComponent<CameraComponent>().FixedAspectRatio);
+
+        std::filesystem::remove(path);
+        return true;
+    }
+
+    bool TestBinarySceneRejectsOtherVersions() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-Version.vntb";
+
+        Ref<Scene> scene = NewRef<Scene>();
+        scene->CreateEntity("Entity");
+        TRUE_OR_FAIL(BinarySceneSerializer(path).Serialize(scene));
+
+        // Version follows the 4 byte magic
+        {
+            std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+            const uint32 version = BinarySceneSerializer::VERSION + 1;
+            file.seekp(4);
+            file.write((const char*)&version, sizeof(uint32));
+        }
+
+        Ref<Scene> loaded = NewRef<Scene>();
+        TRUE_OR_FAIL(!BinarySceneSerializer(path).Deserialize(loaded));
+
+        std::filesystem::remove(path);
+        return true;
+    }
+}
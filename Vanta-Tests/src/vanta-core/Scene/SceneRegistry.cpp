@@ -102,4 +102,139 @@ namespace Testing {
 
         return true;
     }
+
+    bool TestScenePhysicsWritesBackMovedBodies() {
+        static constexpr usize BODY_COUNT = 1000;
+        static constexpr usize FRAMES = 3;
+
+        Scene scene;
+
+        // Falling bodies, enough to be written back in parallel, over a row of static ones
+        std::vector<entt::entity> dynamicBodies;
+        std::vector<entt::entity> staticBodies;
+        for (usize i = 0; i < BODY_COUNT; i++) {
+            auto entity = scene.CreateEntity("Dynamic");
+            entity.GetComponent<TransformComponent>().SetPosition({ i * 2.f, 0.f, 5.f });
+            entity.AddComponent<Rigidbody2DComponent>().Type = Rigidbody2DComponent::BodyType::Dynamic;
+            entity.AddComponent<BoxCollider2DComponent>();
+            dynamicBodies.push_back(entity.GetHandle());
+
+            auto ground = scene.CreateEntity("Static");
+            ground.GetComponent<TransformComponent>().SetPosition({ i * 2.f, -100.f, 0.f });
+            ground.AddComponent<Rigidbody2DComponent>();
+            ground.AddComponent<BoxCollider2DComponent>();
+            staticBodies.push_back(ground.GetHandle());
+        }
+
+        scene.OnSimulationBegin();
+        for (usize i = 0; i < FRAMES; i++)
+            scene.OnUpdateSimulation(1.0 / 60.0, nullptr);
+
+        // Static bodies never move, so they get no commands
+        TRUE_OR_FAIL(scene.GetTransformCommandDiagnostics().Enqueued == BODY_COUNT * FRAMES);
+        TRUE_OR_FAIL(scene.GetTransformCommandDiagnostics().Dropped == 0);
+
+        for (usize i = 0; i < BODY_COUNT; i++) {
+            const auto& tr = scene.GetComponent<TransformComponent>(dynamicBodies[i]);
+            TRUE_OR_FAIL(tr.GetPosition().y < 0.f);
+            TRUE_OR_FAIL(tr.GetPosition().z == 5.f);
+
+            const auto& ground = scene.GetComponent<TransformComponent>(staticBodies[i]);
+            TRUE_OR_FAIL((ground.GetPosition() == glm::vec3(i * 2.f, -100.f, 0.f)));
+        }
+
+        scene.OnSimulationEnd();
+        return true;
+    }
+
+    bool TestSceneFixedTimestep() {
+        Scene scene;
+        scene.SetSimulationSettings({ .TickRate = 60.0, .MaxStepsPerFrame = 4 });
+
+        auto entity = scene.CreateEntity("Falling");
+        entity.AddComponent<Rigidbody2DComponent>().Type = Rigidbody2DComponent::BodyType::Dynamic;
+        entity.AddComponent<BoxCollider2DComponent>();
+
+        auto still = scene.CreateEntity("Still");
+        still.GetComponent<TransformComponent>().SetPosition({ 5.f, 0.f, 0.f });
+
+        // Every step writes back the falling body exactly once
+        auto steps = [&]() { return scene.GetTransformCommandDiagnostics().Enqueued; };
+
+        scene.OnSimulationBegin();
+
+        // Half a step: nothing is simulated, and rendering sits halfway to the next step
+        scene.OnUpdateSimulation(1.0 / 120.0, nullptr);
+        TRUE_OR_FAIL(steps() == 0);
+
+        scene.OnUpdateSimulation(1.0 / 120.0, nullptr);
+        TRUE_OR_FAIL(steps() == 1);
+        TRUE_OR_FAIL(scene.GetInterpolationAlpha() == 0.0);
+
+        // Rendered transform lies between the previous and the latest step
+        scene.OnUpdateSimulation(1.0 / 120.0, nullptr);
+        TRUE_OR_FAIL(steps() == 1);
+        TRUE_OR_FAIL(scene.GetInterpolationAlpha() == 0.5);
+
+        const float latestY = entity.GetComponent<TransformComponent>().GetPosition().y;
+        const float renderedY = scene.GetRenderTransform(entity.GetHandle())[3].y;
+        TRUE_OR_FAIL(latestY < 0.f);
+        TRUE_OR_FAIL(renderedY > latestY && renderedY < 0.f);
+
+        // Transforms that didn't change during the step are drawn where they are
+        TRUE_OR_FAIL(scene.GetRenderTransform(still.GetHandle()) == still.GetComponent<TransformComponent>().GetTransform());
+
+        // A long frame only catches up so far
+        scene.OnUpdateSimulation(1.0, nullptr);
+        TRUE_OR_FAIL(steps() == 5);
+        TRUE_OR_FAIL(scene.GetInterpolationAlpha() < 1.0);
+
+        scene.OnSimulationEnd();
+        return true;
+    }
+
+    bool TestScenePhysicsWorkersDeterministic() {
+        static constexpr usize BODY_COUNT = 400;
+        static constexpr usize FRAMES = 30;
+
+        // Box2D results don't depend on how its work is spread over threads
+        auto simulate = [](uint workers) {
+            Scene scene;
+            scene.SetSimulationSettings({ .PhysicsWorkers = workers });
+
+            auto ground = scene.CreateEntity("Ground");
+            ground.GetComponent<TransformComponent>().SetScale({ 200.f, 1.f, 1.f });
+            ground.AddComponent<Rigidbody2DComponent>();
+            ground.AddComponent<BoxCollider2DComponent>();
+
+            std::vector<Entity> boxes;
+            for (usize i = 0; i < BODY_COUNT; i++) {
+                auto box = scene.CreateEntity("Box");
+                box.GetComponent<TransformComponent>().SetPosition({ (i % 20) * 0.9f - 9.f, 1.f + (i / 20) * 1.1f, 0.f });
+                box.AddComponent<Rigidbody2DComponent>().Type = Rigidbody2DComponent::BodyType::Dynamic;
+                box.AddComponent<BoxCollider2DComponent>();
+                boxes.push_back(box);
+            }
+
+            scene.OnSimulationBegin();
+            for (usize i = 0; i < FRAMES; i++)
+                scene.OnUpdateSimulation(scene.GetFixedDelta(), nullptr);
+
+            std::vector<glm::vec3> positions;
+            for (auto& box : boxes)
+                positions.push_back(box.GetComponent<TransformComponent>().GetPosition());
+
+            scene.OnSimulationEnd();
+            return positions;
+        };
+
+        const auto serial = simulate(1);
+        const auto parallel = simulate(4);
+
+        TRUE_OR_FAIL(serial.size() == parallel.size());
+        for (usize i = 0; i < serial.size(); i++)
+            TRUE_OR_FAIL((serial[i] == parallel[i]));
+
+        return true;
+    }
 }
@@ -0,0 +1,151 @@
+#include <vanta-test-utils/CoreTestsCommon.hpp>
+#include <Vanta/Scene/Serializer.hpp>
+
+namespace Testing {
+
+    static Ref<Scene> CreateSerializerTestScene(usize entityCount) {
+        Ref<Scene> scene = NewRef<Scene>();
+        for (usize i = 0; i < entityCount; i++) {
+            Entity entity = scene->CreateEntity("Entity " + std::to_string(i));
+            entity.GetComponent<TransformComponent>().SetPosition({ (float)i, 1.f, 0.f });
+            if (i % 2 == 0)
+                entity.AddComponent<SpriteComponent>(glm::vec4{ 0.f, 1.f, 0.f, 1.f });
+        }
+        return scene;
+    }
+
+    bool TestSceneSerializerReadsSingleKeys() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-Keys.vnta";
+
+        Ref<Scene> scene = CreateSerializerTestScene(50);
+        SceneSerializer serializer(path);
+        serializer.Serialize(scene);
+        TRUE_OR_FAIL(std::filesystem::exists(path));
+        TRUE_OR_FAIL(!std::filesystem::exists(path.string() + ".tmp"));
+        serializer.Append("ViewportCameraPosition", glm::vec3{ 1.f, 2.f, 3.f });
+        serializer.Append("ViewportCameraRotation", glm::vec3{ 4.f, 5.f, 6.f });
+
+        // Keys are found from the index, without parsing the scene
+        auto position = serializer.Get<glm::vec3>("ViewportCameraPosition");
+        auto rotation = serializer.Get<glm::vec3>("ViewportCameraRotation");
+        TRUE_OR_FAIL(position && *position == glm::vec3(1.f, 2.f, 3.f));
+        TRUE_OR_FAIL(rotation && *rotation == glm::vec3(4.f, 5.f, 6.f));
+        TRUE_OR_FAIL(!serializer.Get<glm::vec3>("Missing"));
+        TRUE_OR_FAIL(serializer.GetIndex().Keys.size() == 3);
+
+        // The streamed file still loads as a whole
+        Ref<Scene> loaded = NewRef<Scene>();
+        TRUE_OR_FAIL(SceneSerializer(path).Deserialize(loaded));
+        usize count = 0;
+        loaded->View<IDComponent>([&](entt::entity, IDComponent&) { count++; });
+        TRUE_OR_FAIL(count == 50);
+
+        std::filesystem::remove(path);
+        return true;
+    }
+
+    bool TestSceneSerializerReadsSingleEntities() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-Entities.vnta";
+
+        Ref<Scene> scene = CreateSerializerTestScene(50);
+        SceneSerializer serializer(path);
+        serializer.Serialize(scene);
+        TRUE_OR_FAIL(serializer.GetIndex().Entities.size() == 50);
+
+        Entity original = scene->GetEntityByName("Entity 42");
+        TRUE_OR_FAIL(original);
+
+        Ref<Scene> loaded = NewRef<Scene>();
+        Entity entity = serializer.DeserializeEntity(loaded, original.GetUUID());
+        TRUE_OR_FAIL(entity);
+        TRUE_OR_FAIL(entity.GetName() == "Entity 42");
+        TRUE_OR_FAIL(entity.GetComponent<TransformComponent>().GetPosition() == glm::vec3(42.f, 1.f, 0.f));
+        TRUE_OR_FAIL(entity.HasComponent<SpriteComponent>());
+
+        // Only the requested entity is added
+        usize count = 0;
+        loaded->View<IDComponent>([&](entt::entity, IDComponent&) { count++; });
+        TRUE_OR_FAIL(count == 1);
+
+        TRUE_OR_FAIL(!serializer.DeserializeEntity(loaded, UUID()));
+
+        std::filesystem::remove(path);
+        return true;
+    }
+
+    bool TestSceneSerializerFailsOnBrokenEntity() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-Broken.vnta";
+
+        Ref<Scene> scene = CreateSerializerTestScene(50);
+        SceneSerializer(path).Serialize(scene);
+
+        // Break the header of one entity in the middle of the file
+        std::string text;
+        {
+            std::ifstream in(path, std::ios::in | std::ios::binary);
+            text.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        const usize header = text.find("- Entity: [Entity 25");
+        TRUE_OR_FAIL(header != std::string::npos);
+        text.replace(header, 11, "- Entity: [[");
+        {
+            std::ofstream out(path, std::ios::out | std::ios::binary);
+            out << text;
+        }
+
+        // The whole load fails, instead of leaving the entity out
+        Ref<Scene> loaded = NewRef<Scene>();
+        TRUE_OR_FAIL(!SceneSerializer(path).Deserialize(loaded));
+
+        // Lookups can't tell which entity is which either
+        Entity original = scene->GetEntityByName("Entity 10");
+        TRUE_OR_FAIL(!SceneSerializer(path).DeserializeEntity(loaded, original.GetUUID()));
+
+        std::filesystem::remove(path);
+        return true;
+    }
+
+    bool TestSceneSerializerLoadsInParallel() {
+        const Path path = std::filesystem::temp_directory_path() / "Vanta-Tests-Parallel.vnta";
+
+        // Enough entities to be split between several jobs
+        Ref<Scene> scene = CreateSerializerTestScene(2000);
+        Entity camera = scene->CreateEntity("Camera");
+        camera.AddComponent<CameraComponent>().Camera->SetOrthographicSize(15.f);
+        scene->SetActiveCameraEntity(camera);
+
+        SceneSerializer(path).Serialize(scene);
+
+        Ref<Scene> loaded = NewRef<Scene>();
+        TRUE_OR_FAIL(SceneSerializer(path).Deserialize(loaded));
+
+        // Every entity is added once, with its own ID and components
+        usize count = 0;
+        bool same = true;
+        scene->View<IDComponent>([&](entt::entity handle, IDComponent& id) {
+            count++;
+            Entity original(handle, scene.get());
+            Entity copy = loaded->GetEntityByID(id.ID);
+            if (!copy || copy.GetName() != id.Name) {
+                same = false;
+                return;
+            }
+
+            same &= copy.GetComponent<TransformComponent>().GetPosition() == original.GetComponent<TransformComponent>().GetPosition();
+            same &= copy.HasComponent<SpriteComponent>() == original.HasComponent<SpriteComponent>();
+        });
+        TRUE_OR_FAIL(same);
+        TRUE_OR_FAIL(count == 2001);
+
+        usize loadedCount = 0;
+        loaded->View<IDComponent>([&](entt::entity, IDComponent&) { loadedCount++; });
+        TRUE_OR_FAIL(loadedCount == 2001);
+
+        Entity loadedCamera = loaded->GetActiveCameraEntity();
+        TRUE_OR_FAIL(loadedCamera && loadedCamera.GetUUID() == camera.GetUUID());
+        TRUE_OR_FAIL(loadedCamera.GetComponent<CameraComponent>().Camera->GetOrthographicSize() == 15.f);
+
+        std::filesystem::remove(path);
+        return true;
+    }
+}
@@ -1,5 +1,7 @@
 #include <vanta-test-utils/CoreTestsCommon.hpp>
 
+#include <latch>
+
 namespace Testing {
 
     static entt::entity MakeEntityWithTransform(entt::registry& reg) {
@@ -225,4 +227,252 @@ namespace Testing {
         TRUE_OR_FAIL(q.GetDiagnostics().Dropped == 0);
         return true;
     }
+
+    bool PhaseBucketsApplyIndependently() {
+        TransformCommandQueue q;
+        entt::registry reg;
+        auto e = MakeEntityWithTransform(reg);
+
+        for (int i = 0; i < 8; i++) {
+            q.Enqueue(SetPositionCommand{ {e, CommandSource::NativeScript, CommandPhase::Script}, {(float)i, 0.f, 0.f} });
+            q.Enqueue(SetRotationCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {0.f, 0.f, (float)i} });
+        }
+        q.Enqueue(SetScaleCommand{ {e, CommandSource::Editor, CommandPhase::Editor}, {4.f, 4.f, 4.f} });
+
+        q.Apply(reg, CommandPhase::Physics);
+
+        TRUE_OR_FAIL(q.PendingCount(CommandPhase::Physics) == 0);
+        TRUE_OR_FAIL(q.PendingCount(CommandPhase::Script) == 8);
+        TRUE_OR_FAIL(q.PendingCount(CommandPhase::Editor) == 1);
+        TRUE_OR_FAIL(reg.get<TransformComponent>(e).GetPosition() == glm::vec3(0.f));
+        TRUE_OR_FAIL(reg.get<TransformComponent>(e).GetRotationRadians() == glm::vec3(0.f, 0.f, 7.f));
+
+        // A phase applied earlier in the frame accepts new commands again
+        q.Enqueue(SetRotationCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {0.f, 0.f, 1.f} });
+        TRUE_OR_FAIL(q.PendingCount(CommandPhase::Physics) == 1);
+        TRUE_OR_FAIL(q.PendingCount() == 10);
+
+        q.Apply(reg, CommandPhase::Script);
+        q.Apply(reg, CommandPhase::Editor);
+        q.Apply(reg, CommandPhase::Physics);
+
+        const auto& tc = reg.get<TransformComponent>(e);
+        TRUE_OR_FAIL(tc.GetPosition() == glm::vec3(7.f, 0.f, 0.f));
+        TRUE_OR_FAIL(tc.GetRotationRadians() == glm::vec3(0.f, 0.f, 1.f));
+        TRUE_OR_FAIL(tc.GetScale() == glm::vec3(4.f));
+        TRUE_OR_FAIL(q.PendingCount() == 0);
+        return true;
+    }
+
+    bool ConcurrentEnqueueFromThreads() {
+        static constexpr usize PRODUCERS = 4;
+        static constexpr usize PER_PRODUCER = 256;
+
+        TransformCommandQueue q;
+        entt::registry reg;
+
+        std::vector<entt::entity> entities;
+        for (usize i = 0; i < PRODUCERS * PER_PRODUCER; i++)
+            entities.push_back(MakeEntityWithTransform(reg));
+
+        std::vector<std::thread> producers;
+        for (usize p = 0; p < PRODUCERS; p++) {
+            producers.emplace_back([&q, &entities, p]() {
+                for (usize i = 0; i < PER_PRODUCER; i++) {
+                    auto e = entities[p * PER_PRODUCER + i];
+                    q.Enqueue(SetPositionCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {(float)p, (float)i, 0.f} });
+                    q.Enqueue(SetPositionCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {(float)p, (float)i, 1.f} });
+                }
+            });
+        }
+        for (auto& producer : producers)
+            producer.join();
+
+        TRUE_OR_FAIL(q.PendingCount() == PRODUCERS * PER_PRODUCER * 2);
+        TRUE_OR_FAIL(q.PendingCount(CommandPhase::Physics) == PRODUCERS * PER_PRODUCER * 2);
+        TRUE_OR_FAIL(q.GetDiagnostics().Enqueued == PRODUCERS * PER_PRODUCER * 2);
+
+        q.Apply(reg, CommandPhase::Physics);
+
+        TRUE_OR_FAIL(q.PendingCount() == 0);
+        TRUE_OR_FAIL(q.GetDiagnostics().Applied == PRODUCERS * PER_PRODUCER);
+        TRUE_OR_FAIL(q.GetDiagnostics().Coalesced == PRODUCERS * PER_PRODUCER);
+
+        // Every producer's last write for its entities must win
+        for (usize p = 0; p < PRODUCERS; p++) {
+            for (usize i = 0; i < PER_PRODUCER; i++) {
+                auto e = entities[p * PER_PRODUCER + i];
+                TRUE_OR_FAIL(reg.get<TransformComponent>(e).GetPosition() == glm::vec3((float)p, (float)i, 1.f));
+            }
+        }
+        return true;
+    }
+
+    bool CoalescesCommandsPerEntity() {
+        TransformCommandQueue q;
+        entt::registry reg;
+        auto e1 = MakeEntityWithTransform(reg);
+        auto e2 = MakeEntityWithTransform(reg);
+
+        for (int i = 1; i <= 10; i++)
+            q.Enqueue(SetPositionCommand{ {e1, CommandSource::NativeScript, CommandPhase::Script}, {(float)i, 0.f, 0.f} });
+        q.Enqueue(SetRotationCommand{ {e1, CommandSource::NativeScript, CommandPhase::Script}, {0.f, 0.f, 2.f} });
+        q.Enqueue(SetScaleCommand{ {e2, CommandSource::NativeScript, CommandPhase::Script}, {3.f, 3.f, 3.f} });
+
+        q.Apply(reg, CommandPhase::Script);
+
+        const auto& tc1 = reg.get<TransformComponent>(e1);
+        TRUE_OR_FAIL(tc1.GetPosition() == glm::vec3(10.f, 0.f, 0.f));
+        TRUE_OR_FAIL(tc1.GetRotationRadians() == glm::vec3(0.f, 0.f, 2.f));
+        TRUE_OR_FAIL(tc1.GetScale() == glm::vec3(1.f));
+
+        const auto& tc2 = reg.get<TransformComponent>(e2);
+        TRUE_OR_FAIL(tc2.GetPosition() == glm::vec3(0.f));
+        TRUE_OR_FAIL(tc2.GetScale() == glm::vec3(3.f));
+
+        TRUE_OR_FAIL(q.GetDiagnostics().Enqueued == 12);
+        TRUE_OR_FAIL(q.GetDiagnostics().Applied == 2);
+        TRUE_OR_FAIL(q.GetDiagnostics().Coalesced == 10);
+        TRUE_OR_FAIL(q.GetDiagnostics().Dropped == 0);
+        return true;
+    }
+
+    bool InOrderModeMatchesCoalesced() {
+        auto runFrame = [](CommandApplyMode mode, CommandQueueDiagnostics& diagnostics) -> TransformComponent {
+            TransformCommandQueue q;
+            q.SetApplyMode(mode);
+            entt::registry reg;
+            auto e = MakeEntityWithTransform(reg);
+
+            q.Enqueue(SetTransformCommand{ {e, CommandSource::Editor, CommandPhase::Script}, {1.f, 1.f, 1.f}, {0.f, 0.f, 1.f}, {2.f, 2.f, 2.f} });
+            q.Enqueue(SetPositionCommand{ {e, CommandSource::NativeScript, CommandPhase::Script}, {5.f, 0.f, 0.f} });
+            q.Enqueue(SetScaleCommand{ {e, CommandSource::NativeScript, CommandPhase::Script}, {7.f, 7.f, 7.f} });
+            q.Apply(reg, CommandPhase::Script);
+
+            diagnostics = q.GetDiagnostics();
+            return reg.get<TransformComponent>(e);
+        };
+
+        CommandQueueDiagnostics inOrderDiagnostics, coalescedDiagnostics;
+        auto inOrder = runFrame(CommandApplyMode::InOrder, inOrderDiagnostics);
+        auto coalesced = runFrame(CommandApplyMode::Coalesced, coalescedDiagnostics);
+
+        TRUE_OR_FAIL(inOrder.GetPosition() == coalesced.GetPosition());
+        TRUE_OR_FAIL(inOrder.GetRotationRadians() == coalesced.GetRotationRadians());
+        TRUE_OR_FAIL(inOrder.GetScale() == coalesced.GetScale());
+
+        TRUE_OR_FAIL(inOrderDiagnostics.Applied == 3);
+        TRUE_OR_FAIL(inOrderDiagnostics.Coalesced == 0);
+        TRUE_OR_FAIL(coalescedDiagnostics.Applied == 1);
+        TRUE_OR_FAIL(coalescedDiagnostics.Coalesced == 2);
+        return true;
+    }
+
+    bool ParallelApplyLargeBatch() {
+        static constexpr usize ENTITY_COUNT = 16 * 1024;
+
+        TransformCommandQueue q;
+        entt::registry reg;
+
+        std::vector<entt::entity> entities;
+        for (usize i = 0; i < ENTITY_COUNT; i++)
+            entities.push_back(MakeEntityWithTransform(reg));
+
+        // Destroyed entities in the batch must be dropped without affecting neighbouring ranges
+        for (usize i = 0; i < ENTITY_COUNT; i += 97)
+            reg.destroy(entities[i]);
+
+        for (usize i = 0; i < ENTITY_COUNT; i++) {
+            q.Enqueue(SetPositionCommand{ {entities[i], CommandSource::Physics, CommandPhase::Physics}, {(float)i, 0.f, 0.f} });
+            q.Enqueue(SetRotationCommand{ {entities[i], CommandSource::Physics, CommandPhase::Physics}, {0.f, 0.f, (float)i} });
+        }
+
+        q.Apply(reg, CommandPhase::Physics);
+
+        usize alive = 0;
+        for (usize i = 0; i < ENTITY_COUNT; i++) {
+            if (!reg.valid(entities[i]))
+                continue;
+
+            alive++;
+            const auto& tc = reg.get<TransformComponent>(entities[i]);
+            TRUE_OR_FAIL(tc.GetPosition() == glm::vec3((float)i, 0.f, 0.f));
+            TRUE_OR_FAIL(tc.GetRotationRadians() == glm::vec3(0.f, 0.f, (float)i));
+        }
+
+        const auto diagnostics = q.GetDiagnostics();
+        TRUE_OR_FAIL(diagnostics.Applied == alive);
+        TRUE_OR_FAIL(diagnostics.Coalesced == alive);
+        TRUE_OR_FAIL(diagnostics.Dropped == (ENTITY_COUNT - alive) * 2);
+        TRUE_OR_FAIL(q.PendingCount() == 0);
+        return true;
+    }
+
+    bool MoreProducersThanSlots() {
+        static constexpr usize PRODUCERS = MAX_COMMAND_PRODUCERS * 2;
+
+        TransformCommandQueue q;
+        entt::registry reg;
+
+        std::vector<entt::entity> entities;
+        for (usize i = 0; i < PRODUCERS; i++)
+            entities.push_back(MakeEntityWithTransform(reg));
+
+        // Every producer stays alive until all have enqueued, so slots run out
+        std::latch enqueued(PRODUCERS);
+        std::vector<std::thread> producers;
+        for (usize p = 0; p < PRODUCERS; p++) {
+            producers.emplace_back([&q, &entities, &enqueued, p]() {
+                q.Enqueue(SetPositionCommand{ {entities[p], CommandSource::Physics, CommandPhase::Physics}, {(float)p, 0.f, 0.f} });
+                enqueued.arrive_and_wait();
+            });
+        }
+        for (auto& producer : producers)
+            producer.join();
+
+        TRUE_OR_FAIL(q.PendingCount() == PRODUCERS);
+        q.Apply(reg, CommandPhase::Physics);
+        TRUE_OR_FAIL(q.GetDiagnostics().Applied == PRODUCERS);
+        for (usize p = 0; p < PRODUCERS; p++)
+            TRUE_OR_FAIL(reg.get<TransformComponent>(entities[p]).GetPosition() == glm::vec3((float)p, 0.f, 0.f));
+
+        // Slots of exited threads are given back
+        usize slot = SHARED_COMMAND_PRODUCER;
+        std::thread([&slot]() { slot = CommandProducerSlot(); }).join();
+        TRUE_OR_FAIL(slot != SHARED_COMMAND_PRODUCER);
+        return true;
+    }
+
+    bool SameEntityMergeFollowsSequence() {
+        // Two live producers write the same entity. The second thread leases its slot first,
+        // so merging by slot alone would let the earlier write win.
+        for (int i = 0; i < 16; i++) {
+            TransformCommandQueue q;
+            entt::registry reg;
+            auto e = MakeEntityWithTransform(reg);
+            auto other = MakeEntityWithTransform(reg);
+
+            std::latch secondLeased(1);
+            std::latch firstWritten(1);
+
+            std::thread second([&]() {
+                q.Enqueue(SetPositionCommand{ {other, CommandSource::Physics, CommandPhase::Physics}, {9.f, 0.f, 0.f} });
+                secondLeased.count_down();
+                firstWritten.wait();
+                q.Enqueue(SetPositionCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {2.f, 0.f, 0.f} });
+            });
+            std::thread first([&]() {
+                secondLeased.wait();
+                q.Enqueue(SetPositionCommand{ {e, CommandSource::Physics, CommandPhase::Physics}, {1.f, 0.f, 0.f} });
+                firstWritten.count_down();
+            });
+            first.join();
+            second.join();
+
+            q.Apply(reg, CommandPhase::Physics);
+            TRUE_OR_FAIL(reg.get<TransformComponent>(e).GetPosition() == glm::vec3(2.f, 0.f, 0.f));
+            TRUE_OR_FAIL(reg.get<TransformComponent>(other).GetPosition() == glm::vec3(9.f, 0.f, 0.f));
+        }
+        return true;
+    }
 }
@@ -2,18 +2,17 @@
 #version 450 core
 
 layout(location = 0) in vec3 aWorldPosition;
-layout(location = 1) in vec3 aLocalPosition;
-layout(location = 2) in vec4 aColor;
-layout(location = 3) in float aThickness;
-layout(location = 4) in float aFade;
-layout(location = 5) in int aEntityID;
+layout(location = 1) in vec2 aLocalPosition; // Half floats
+layout(location = 2) in vec4 aColor;         // RGBA8
+layout(location = 3) in vec2 aThicknessFade; // Unorm16
+layout(location = 4) in int aEntityID;
 
 layout(std140, binding = 0) uniform Camera {
     mat4 uViewProjection;
 };
 
 struct VertexOutput {
-    vec3 LocalPosition;
+    vec2 LocalPosition;
     vec4 Color;
     float Thickness;
     float Fade;
@@ -25,8 +24,8 @@ layout(location = 4) out int vEntityID;
 void main() {
     Output.LocalPosition = aLocalPosition;
     Output.Color = aColor;
-    Output.Thickness = aThickness;
-    Output.Fade = aFade;
+    Output.Thickness = aThicknessFade.x;
+    Output.Fade = aThicknessFade.y;
 
     vEntityID = aEntityID;
 
@@ -38,7 +37,7 @@ void main() {
 #version 450 core
 
 struct VertexOutput {
-    vec3 LocalPosition;
+    vec2 LocalPosition;
     vec4 Color;
     float Thickness;
     float Fade;
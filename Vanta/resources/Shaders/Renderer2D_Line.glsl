@@ -10,7 +10,7 @@ struct VertexOutput {
 };
 
 layout(location = 0) in vec3 aPosition;
-layout(location = 1) in vec4 aColor;
+layout(location = 1) in vec4 aColor; // RGBA8
 layout(location = 2) in int aEntityID;
 
 layout(location = 0) out VertexOutput Output;
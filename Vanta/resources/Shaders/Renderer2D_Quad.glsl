@@ -1,17 +1,35 @@
 #type vertex
-#version 450 core
+#version 460 core
 
-layout(location = 0) in vec3 aPosition;
-layout(location = 1) in vec4 aColor;
-layout(location = 2) in vec2 aTexCoords;
-layout(location = 3) in float aTilingFactor;
-layout(location = 4) in int aTexID;
-layout(location = 5) in int aEntityID;
+// Per-instance quad data
+layout(location = 0) in vec3 aAxisX; // Transformed X and Y axes of the unit quad
+layout(location = 1) in vec3 aAxisY;
+layout(location = 2) in vec3 aTranslation;
+layout(location = 3) in vec4 aColor; // RGBA8
+layout(location = 4) in float aTilingFactor;
+layout(location = 5) in int aTexID;
+layout(location = 6) in int aEntityID;
 
 layout(std140, binding = 0) uniform Camera {
     mat4 uViewProjection;
 };
 
+// Texture unit each batch's slots are bound to, one entry per draw of a multi-draw
+struct BatchState {
+    uint Units[16];
+};
+
+layout(std430, binding = 1) readonly buffer Batches {
+    BatchState uBatches[];
+};
+
+const vec2 cCorners[4] = vec2[](
+    vec2(-0.5, -0.5),
+    vec2( 0.5, -0.5),
+    vec2( 0.5,  0.5),
+    vec2(-0.5,  0.5)
+);
+
 struct VertexOutput {
     vec4 Color;
     vec2 TexCoords;
@@ -23,21 +41,29 @@ layout(location = 3) out flat int vTexID;
 layout(location = 4) out flat int vEntityID;
 
 void main() {
+    // Quads are drawn with indices 0-3, one instance each
+    vec2 corner = cCorners[gl_VertexID];
+
     Output.Color = aColor;
-    Output.TexCoords = aTexCoords;
+    Output.TexCoords = corner + 0.5;
     Output.TilingFactor = aTilingFactor;
 
-    vTexID = aTexID;
+    // Swap the batch's slot for the unit it's bound to, keeping the layer
+    uint unit = uBatches[gl_DrawID].Units[aTexID & 0xff];
+    vTexID = (aTexID & ~0xff) | int(unit);
     vEntityID = aEntityID;
 
-    gl_Position = uViewProjection * vec4(aPosition, 1.0);
+    vec3 position = aAxisX * corner.x + aAxisY * corner.y + aTranslation;
+    gl_Position = uViewProjection * vec4(position, 1.0);
 }
 
 
 #type fragment
-#version 450 core
+#version 460 core
 
-layout(binding = 0) uniform sampler2D uTextures[16];
+// Every unit holds a texture array, with equally sized textures in its layers.
+// A batch uses up to 16 of them; the batches of a multi-draw share all 32.
+layout(binding = 0) uniform sampler2DArray uTextures[32];
 
 struct VertexOutput {
     vec4 Color;
@@ -55,40 +81,44 @@ layout(location = 1) out int fEntityID;
 void main() {
     vec4 texColor = Input.Color;
 
-    switch(vTexID)
+    // TexID packs the unit into the low 8 bits and the layer into the rest
+    int slot = vTexID & 0xff;
+    vec3 texCoords = vec3(Input.TexCoords * Input.TilingFactor, float(vTexID >> 8));
+
+    switch(slot)
     {
-        case  0: texColor *= texture(uTextures[ 0], Input.TexCoords * Input.TilingFactor); break;
-        case  1: texColor *= texture(uTextures[ 1], Input.TexCoords * Input.TilingFactor); break;
-        case  2: texColor *= texture(uTextures[ 2], Input.TexCoords * Input.TilingFactor); break;
-        case  3: texColor *= texture(uTextures[ 3], Input.TexCoords * Input.TilingFactor); break;
-        case  4: texColor *= texture(uTextures[ 4], Input.TexCoords * Input.TilingFactor); break;
-        case  5: texColor *= texture(uTextures[ 5], Input.TexCoords * Input.TilingFactor); break;
-        case  6: texColor *= texture(uTextures[ 6], Input.TexCoords * Input.TilingFactor); break;
-        case  7: texColor *= texture(uTextures[ 7], Input.TexCoords * Input.TilingFactor); break;
-        case  8: texColor *= texture(uTextures[ 8], Input.TexCoords * Input.TilingFactor); break;
-        case  9: texColor *= texture(uTextures[ 9], Input.TexCoords * Input.TilingFactor); break;
-        case 10: texColor *= texture(uTextures[10], Input.TexCoords * Input.TilingFactor); break;
-        case 11: texColor *= texture(uTextures[11], Input.TexCoords * Input.TilingFactor); break;
-        case 12: texColor *= texture(uTextures[12], Input.TexCoords * Input.TilingFactor); break;
-        case 13: texColor *= texture(uTextures[13], Input.TexCoords * Input.TilingFactor); break;
-        case 14: texColor *= texture(uTextures[14], Input.TexCoords * Input.TilingFactor); break;
-        case 15: texColor *= texture(uTextures[15], Input.TexCoords * Input.TilingFactor); break;
-        //case 16: texColor *= texture(uTextures[16], Input.TexCoords * Input.TilingFactor); break;
-        //case 17: texColor *= texture(uTextures[17], Input.TexCoords * Input.TilingFactor); break;
-        //case 18: texColor *= texture(uTextures[18], Input.TexCoords * Input.TilingFactor); break;
-        //case 19: texColor *= texture(uTextures[19], Input.TexCoords * Input.TilingFactor); break;
-        //case 20: texColor *= texture(uTextures[20], Input.TexCoords * Input.TilingFactor); break;
-        //case 21: texColor *= texture(uTextures[21], Input.TexCoords * Input.TilingFactor); break;
-        //case 22: texColor *= texture(uTextures[22], Input.TexCoords * Input.TilingFactor); break;
-        //case 23: texColor *= texture(uTextures[23], Input.TexCoords * Input.TilingFactor); break;
-        //case 24: texColor *= texture(uTextures[24], Input.TexCoords * Input.TilingFactor); break;
-        //case 25: texColor *= texture(uTextures[25], Input.TexCoords * Input.TilingFactor); break;
-        //case 26: texColor *= texture(uTextures[26], Input.TexCoords * Input.TilingFactor); break;
-        //case 27: texColor *= texture(uTextures[27], Input.TexCoords * Input.TilingFactor); break;
-        //case 28: texColor *= texture(uTextures[28], Input.TexCoords * Input.TilingFactor); break;
-        //case 29: texColor *= texture(uTextures[29], Input.TexCoords * Input.TilingFactor); break;
-        //case 30: texColor *= texture(uTextures[30], Input.TexCoords * Input.TilingFactor); break;
-        //case 31: texColor *= texture(uTextures[31], Input.TexCoords * Input.TilingFactor); break;
+        case  0: texColor *= texture(uTextures[ 0], texCoords); break;
+        case  1: texColor *= texture(uTextures[ 1], texCoords); break;
+        case  2: texColor *= texture(uTextures[ 2], texCoords); break;
+        case  3: texColor *= texture(uTextures[ 3], texCoords); break;
+        case  4: texColor *= texture(uTextures[ 4], texCoords); break;
+        case  5: texColor *= texture(uTextures[ 5], texCoords); break;
+        case  6: texColor *= texture(uTextures[ 6], texCoords); break;
+        case  7: texColor *= texture(uTextures[ 7], texCoords); break;
+        case  8: texColor *= texture(uTextures[ 8], texCoords); break;
+        case  9: texColor *= texture(uTextures[ 9], texCoords); break;
+        case 10: texColor *= texture(uTextures[10], texCoords); break;
+        case 11: texColor *= texture(uTextures[11], texCoords); break;
+        case 12: texColor *= texture(uTextures[12], texCoords); break;
+        case 13: texColor *= texture(uTextures[13], texCoords); break;
+        case 14: texColor *= texture(uTextures[14], texCoords); break;
+        case 15: texColor *= texture(uTextures[15], texCoords); break;
+        case 16: texColor *= texture(uTextures[16], texCoords); break;
+        case 17: texColor *= texture(uTextures[17], texCoords); break;
+        case 18: texColor *= texture(uTextures[18], texCoords); break;
+        case 19: texColor *= texture(uTextures[19], texCoords); break;
+        case 20: texColor *= texture(uTextures[20], texCoords); break;
+        case 21: texColor *= texture(uTextures[21], texCoords); break;
+        case 22: texColor *= texture(uTextures[22], texCoords); break;
+        case 23: texColor *= texture(uTextures[23], texCoords); break;
+        case 24: texColor *= texture(uTextures[24], texCoords); break;
+        case 25: texColor *= texture(uTextures[25], texCoords); break;
+        case 26: texColor *= texture(uTextures[26], texCoords); break;
+        case 27: texColor *= texture(uTextures[27], texCoords); break;
+        case 28: texColor *= texture(uTextures[28], texCoords); break;
+        case 29: texColor *= texture(uTextures[29], texCoords); break;
+        case 30: texColor *= texture(uTextures[30], texCoords); break;
+        case 31: texColor *= texture(uTextures[31], texCoords); break;
     }
 
     if (texColor.a == 0.0)
@@ -0,0 +1,90 @@
+#pragma once
+#include "Vanta/Render/Buffer.hpp"
+
+namespace Vanta {
+
+    class NullVertexBuffer : public VertexBuffer {
+    public:
+        NullVertexBuffer() = default;
+        virtual ~NullVertexBuffer() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        const BufferLayout& GetLayout() const override      { return m_Layout; }
+        void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+        void SetData(const void*, usize) override {}
+
+        uint32 GetRendererID() const override { return 0; }
+
+    private:
+        BufferLayout m_Layout;
+    };
+
+    /// <summary>
+    /// Streaming vertex buffer backed by plain memory. There is no GPU to wait for.
+    /// </summary>
+    class NullStreamingVertexBuffer : public StreamingVertexBuffer {
+    public:
+        NullStreamingVertexBuffer(usize regionSize, uint regionCount)
+            : StreamingVertexBuffer(regionSize, regionCount), m_Storage(regionSize * regionCount)
+        {
+            m_Memory = m_Storage.data();
+        }
+        virtual ~NullStreamingVertexBuffer() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        uint32 GetRendererID() const override { return 0; }
+
+    protected:
+        void FenceRegion(uint) override {}
+        void WaitForRegion(uint) override {}
+
+    private:
+        std::vector<uint8> m_Storage;
+    };
+
+    class NullIndexBuffer : public IndexBuffer {
+    public:
+        NullIndexBuffer(uint count) : m_Count(count) {}
+        virtual ~NullIndexBuffer() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        usize GetCount() const override { return m_Count; }
+
+    private:
+        uint m_Count;
+    };
+
+    /// <summary>
+    /// Indirect buffer that keeps its commands in memory, so recorded multi-draws can be inspected.
+    /// </summary>
+    class NullIndirectBuffer : public IndirectBuffer {
+    public:
+        NullIndirectBuffer(uint capacity) : m_Capacity(capacity) {}
+        virtual ~NullIndirectBuffer() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        void SetData(const DrawIndexedIndirectCommand* commands, uint count, uint first = 0) override {
+            VANTA_CORE_ASSERT(first + count <= m_Capacity, "Too many indirect draw commands!");
+            if (m_Commands.size() < first + count)
+                m_Commands.resize(first + count);
+            std::copy(commands, commands + count, m_Commands.begin() + first);
+        }
+
+        uint GetCapacity() const override { return m_Capacity; }
+
+        const std::vector<DrawIndexedIndirectCommand>& GetCommands() const { return m_Commands; }
+
+    private:
+        uint m_Capacity;
+        std::vector<DrawIndexedIndirectCommand> m_Commands;
+    };
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "Vanta/Render/Framebuffer.hpp"
+
+namespace Vanta {
+
+    class NullFramebuffer : public Framebuffer {
+    public:
+        NullFramebuffer(const FramebufferParams& params)
+            : m_Params(params) {}
+        ~NullFramebuffer() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        void Resize(uint32 width, uint32 height) override {
+            m_Params.Width = width;
+            m_Params.Height = height;
+        }
+
+        // Nothing is ever rendered, so there is never an entity under any pixel
+        int ReadPixel(uint32, int, int) override { return -1; }
+
+        // Reads finish right away, since there is no GPU to wait for
+        bool RequestPixels(uint32, int x, int y, uint32 width, uint32 height) override {
+            m_Readback.X = x;
+            m_Readback.Y = y;
+            m_Readback.Width = width;
+            m_Readback.Height = height;
+            m_Readback.Pixels.assign((usize)width * height, -1);
+            m_HasReadback = true;
+            return true;
+        }
+
+        bool PollPixels(FramebufferReadback& readback) override {
+            if (!m_HasReadback)
+                return false;
+
+            readback = m_Readback;
+            m_HasReadback = false;
+            return true;
+        }
+
+        void ClearAttachment(uint32, int) override {}
+
+        uint32 GetColorAttachmentRendererID(uint32 = 0) const override { return 0; }
+
+        const FramebufferParams& GetParams() const override { return m_Params; }
+
+    private:
+        FramebufferParams m_Params;
+
+        FramebufferReadback m_Readback;
+        bool m_HasReadback = false;
+    };
+}
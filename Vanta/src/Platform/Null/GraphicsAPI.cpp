@@ -0,0 +1,51 @@
+#include "vantapch.hpp"
+#include "Platform/Null/GraphicsAPI.hpp"
+#include "Platform/Null/Buffer.hpp"
+
+namespace Vanta {
+
+    void NullGraphicsAPI::Init() {
+        VANTA_PROFILE_FUNCTION();
+        VANTA_CORE_INFO("Using null graphics API; no GPU work will be issued");
+    }
+
+    void NullGraphicsAPI::SetViewport(uint, uint, uint, uint) {}
+
+    void NullGraphicsAPI::SetClearColor(const glm::vec4&) {}
+
+    void NullGraphicsAPI::Clear() {
+        m_Submissions.ClearCalls++;
+    }
+
+    void NullGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount, uint) {
+        usize count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        m_Submissions.DrawIndexedCalls++;
+        m_Submissions.IndexCount += count;
+    }
+
+    void NullGraphicsAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint) {
+        usize count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        m_Submissions.DrawIndexedInstancedCalls++;
+        m_Submissions.IndexCount += count * instanceCount;
+        m_Submissions.InstanceCount += instanceCount;
+    }
+
+    void NullGraphicsAPI::MultiDrawIndexedIndirect(const Ref<VertexArray>&, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand) {
+        const auto& recorded = static_cast<const NullIndirectBuffer&>(*commands).GetCommands();
+        VANTA_CORE_ASSERT(firstCommand + drawCount <= recorded.size(), "Drawing more indirect commands than were set!");
+
+        m_Submissions.MultiDrawIndirectCalls++;
+        m_Submissions.IndirectDrawCount += drawCount;
+        for (uint i = firstCommand; i < firstCommand + drawCount; i++) {
+            m_Submissions.IndexCount += (usize)recorded[i].IndexCount * recorded[i].InstanceCount;
+            m_Submissions.InstanceCount += recorded[i].InstanceCount;
+        }
+    }
+
+    void NullGraphicsAPI::DrawLines(const Ref<VertexArray>&, uint vertexCount, uint) {
+        m_Submissions.DrawLinesCalls++;
+        m_Submissions.LineVertexCount += vertexCount;
+    }
+
+    void NullGraphicsAPI::SetLineWidth(float) {}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Vanta/Render/GraphicsAPI.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Graphics backend that issues no GPU work.
+    /// Draw submissions are only recorded, so headless runs can still be inspected
+    /// and the game loop can be benchmarked without any graphics cost.
+    /// </summary>
+    class NullGraphicsAPI : public GraphicsAPI {
+    public:
+        struct Submissions {
+            usize DrawIndexedCalls = 0;
+            usize DrawIndexedInstancedCalls = 0;
+            usize IndexCount = 0;           ///< Indices drawn, across all instances
+            usize InstanceCount = 0;
+            usize MultiDrawIndirectCalls = 0;
+            usize IndirectDrawCount = 0;    ///< Draws issued through indirect commands
+            usize DrawLinesCalls = 0;
+            usize LineVertexCount = 0;
+            usize ClearCalls = 0;
+        };
+
+        NullGraphicsAPI() = default;
+        ~NullGraphicsAPI() = default;
+
+        void Init() override;
+
+        void SetViewport(uint x, uint y, uint width, uint height) override;
+
+        void SetClearColor(const glm::vec4& color) override;
+        void Clear() override;
+
+        void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount, uint baseVertex) override;
+        void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint baseInstance) override;
+        void MultiDrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand) override;
+        void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount, uint firstVertex) override;
+
+        void SetLineWidth(float width) override;
+
+        /// <summary>
+        /// Submissions recorded since the last reset.
+        /// </summary>
+        const Submissions& GetSubmissions() const { return m_Submissions; }
+        void ResetSubmissions()                   { m_Submissions = Submissions(); }
+
+    private:
+        Submissions m_Submissions;
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Vanta/Render/Shader.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Shader that is never compiled. Only keeps its name, so shader libraries keep working.
+    /// </summary>
+    class NullShader : public Shader {
+    public:
+        NullShader(const Path& filepath)
+            : NullShader(filepath.stem().string(), filepath) {}
+        NullShader(const std::string& name, const Path&)
+            : m_Name(name) {}
+        virtual ~NullShader() = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        const std::string& GetName() const override { return m_Name; }
+
+        void SetInt(const std::string&, int) override {}
+        void SetUInt(const std::string&, uint) override {}
+        void SetIntArray(const std::string&, int*, uint) override {}
+        void SetUIntArray(const std::string&, uint*, uint) override {}
+
+        void SetFloat(const std::string&, float) override {}
+        void SetFloat2(const std::string&, const glm::vec2&) override {}
+        void SetFloat3(const std::string&, const glm::vec3&) override {}
+        void SetFloat4(const std::string&, const glm::vec4&) override {}
+
+        void SetMat3(const std::string&, const glm::mat3&) override {}
+        void SetMat4(const std::string&, const glm::mat4&) override {}
+
+    private:
+        std::string m_Name;
+    };
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Vanta/Render/StorageBuffer.hpp"
+
+namespace Vanta {
+
+    class NullStorageBuffer : public StorageBuffer {
+    public:
+        NullStorageBuffer() = default;
+        virtual ~NullStorageBuffer() = default;
+
+        void Bind() const override {}
+        void BindRange(uint32, uint32) const override {}
+
+        void SetData(const void*, uint32, uint32 = 0) override {}
+    };
+}
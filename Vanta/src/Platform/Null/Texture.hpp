@@ -0,0 +1,90 @@
+#pragma once
+#include "Vanta/Render/Texture.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Texture without GPU storage. Image files are not decoded.
+    /// Every instance gets a unique ID, so texture comparisons behave like real textures.
+    /// </summary>
+    class NullTexture2D : public Texture2D {
+    public:
+        NullTexture2D(uint32 width, uint32 height, const Path& path = Path())
+            : m_RendererID(NextID()), m_Width(width), m_Height(height), m_Path(path) {}
+        NullTexture2D(const Path& path)
+            : m_RendererID(NextID()), m_Path(path) {}
+        ~NullTexture2D() = default;
+
+        void Bind(uint) const override {}
+
+        void SetData(const void* data, usize size) override {
+            m_Opaque = IsOpaqueData(data, size, GetFormat());
+            m_Revision++;
+        }
+
+        void SetImage(const IO::Image& image) override {
+            if (!image)
+                return;
+
+            m_Width = image.Width;
+            m_Height = image.Height;
+            TextureFormat format = image.Channels == 4 ? TextureFormat::RGBA8 : TextureFormat::RGB8;
+            m_Opaque = IsOpaqueData(image.Data, (usize)m_Width * m_Height * image.Channels, format);
+            m_Revision++;
+        }
+
+        bool IsValid() const override { return true; }
+
+        const Path& GetPath() const override { return m_Path; }
+
+        uint32 GetWidth() const override  { return m_Width; }
+        uint32 GetHeight() const override { return m_Height; }
+        TextureFormat GetFormat() const override { return TextureFormat::RGBA8; }
+
+        uint32 GetRendererID() const override { return m_RendererID; };
+
+        bool operator==(const Texture& other) const override {
+            return m_RendererID == other.GetRendererID();
+        }
+        bool operator!=(const Texture& other) const override {
+            return m_RendererID != other.GetRendererID();
+        }
+
+    private:
+        uint32 m_RendererID = 0;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+
+        Path m_Path;
+
+        static uint32 NextID() {
+            static std::atomic<uint32> s_NextID = 1;
+            return s_NextID++;
+        }
+    };
+
+    class NullTexture2DArray : public Texture2DArray {
+    public:
+        NullTexture2DArray(uint32 width, uint32 height, uint32 layerCount, TextureFormat format)
+            : m_Width(width), m_Height(height), m_LayerCount(layerCount), m_Format(format) {}
+        ~NullTexture2DArray() = default;
+
+        void Bind(uint) const override {}
+
+        uint32 GetWidth() const override      { return m_Width; }
+        uint32 GetHeight() const override     { return m_Height; }
+        uint32 GetLayerCount() const override { return m_LayerCount; }
+        TextureFormat GetFormat() const override { return m_Format; }
+
+        uint32 GetRendererID() const override { return 0; }
+
+        void CopyLayer(uint32, const Texture2D&) override {}
+        void CopyLayers(const Texture2DArray&, uint32) override {}
+
+    private:
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        uint32 m_LayerCount = 0;
+        TextureFormat m_Format = TextureFormat::None;
+    };
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "Vanta/Render/UniformBuffer.hpp"
+
+namespace Vanta {
+
+    class NullUniformBuffer : public UniformBuffer {
+    public:
+        NullUniformBuffer() = default;
+        virtual ~NullUniformBuffer() = default;
+
+        void SetData(const void*, uint32, uint32 = 0) override {}
+    };
+}
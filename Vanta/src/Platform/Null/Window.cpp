@@ -0,0 +1,35 @@
+#include "vantapch.hpp"
+#include "Platform/Null/Window.hpp"
+#include "Vanta/Event/WindowEvent.hpp"
+
+namespace Vanta {
+    NullWindow::NullWindow(const WindowParams& params) :
+        m_Title(params.Title),
+        m_Mode(params.Mode),
+        m_Width(params.Width),
+        m_Height(params.Height),
+        m_VerticalSync(params.VerticalSync)
+    {
+        VANTA_CORE_INFO("Created headless window: {}x{}", m_Width, m_Height);
+    }
+
+    void NullWindow::SetTitle(const std::string& title) {
+        m_Title = title;
+    }
+
+    void NullWindow::SetSize(uint width, uint height) {
+        m_Width = width;
+        m_Height = height;
+
+        if (!m_EventCallback) return;
+
+        WindowResizeEvent event(width, height);
+        m_EventCallback(event);
+    }
+
+    void NullWindow::SetMode(WindowMode mode, uint width, uint height) {
+        m_Mode = mode;
+        if (width != 0 && height != 0)
+            SetSize(width, height);
+    }
+}
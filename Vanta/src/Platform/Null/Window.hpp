@@ -0,0 +1,43 @@
+#pragma once
+#include "Vanta/Core/Window.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Window without a display surface or graphics context.
+    /// Used by headless engines, where the requested size is only kept around
+    /// for systems that read viewport dimensions (cameras, scenes).
+    /// </summary>
+    class NullWindow : public Window {
+    public:
+        NullWindow(const WindowParams& params);
+        ~NullWindow() = default;
+
+        void Update() override {}
+
+        void SetTitle(const std::string& title) override;
+        void SetSize(uint width, uint height) override;
+        void SetVSync(bool enabled) override                { m_VerticalSync = enabled; }
+        void SetMode(WindowMode mode, uint width, uint height) override;
+        void SetIcon(const Path&) override                  {}
+        void SetCursorMode(CursorMode mode) override        { m_Cursor = mode; }
+        void SetEventCallback(EventCallbackFn fn) override  { m_EventCallback = fn; }
+
+        std::string GetTitle() const override       { return m_Title; }
+        uint GetWidth() const override              { return m_Width; }
+        uint GetHeight() const override             { return m_Height; }
+        bool GetVSync() const override              { return m_VerticalSync; }
+        WindowMode GetMode() const override         { return m_Mode; }
+        CursorMode GetCursorMode() const override   { return m_Cursor; }
+
+        void* GetNativeWindow() const override { return nullptr; }
+
+    private:
+        std::string m_Title;
+        WindowMode m_Mode;
+        uint m_Width, m_Height;
+        bool m_VerticalSync;
+        CursorMode m_Cursor = CursorMode::Normal;
+        EventCallbackFn m_EventCallback;
+    };
+}
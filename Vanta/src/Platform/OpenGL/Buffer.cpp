@@ -42,6 +42,73 @@ namespace Vanta {
     }
 
 
+    static constexpr GLbitfield STREAMING_BUFFER_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(usize regionSize, uint regionCount)
+        : StreamingVertexBuffer(regionSize, regionCount), m_Fences(regionCount, nullptr)
+    {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        const usize size = regionSize * regionCount;
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, size, nullptr, STREAMING_BUFFER_FLAGS);
+        m_Memory = (uint8*)glMapNamedBufferRange(m_RendererID, 0, size, STREAMING_BUFFER_FLAGS);
+
+        VANTA_CORE_ASSERT(m_Memory, "Failed to map streaming vertex buffer!");
+    }
+
+    OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        for (void* fence : m_Fences) {
+            if (fence)
+                glDeleteSync((GLsync)fence);
+        }
+
+        glUnmapNamedBuffer(m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void OpenGLStreamingVertexBuffer::Bind() const {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    }
+
+    void OpenGLStreamingVertexBuffer::Unbind() const {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void OpenGLStreamingVertexBuffer::FenceRegion(uint region) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        if (m_Fences[region])
+            glDeleteSync((GLsync)m_Fences[region]);
+        m_Fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    void OpenGLStreamingVertexBuffer::WaitForRegion(uint region) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        GLsync fence = (GLsync)m_Fences[region];
+        if (!fence)
+            return;
+
+        // Flush on the first wait, so the fence is guaranteed to signal eventually
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        for (;;) {
+            GLenum result = glClientWaitSync(fence, flags, 1'000'000); // 1ms
+            if (result != GL_TIMEOUT_EXPIRED) {
+                VANTA_CORE_ASSERT(result != GL_WAIT_FAILED, "Failed waiting for streaming vertex buffer region!");
+                break;
+            }
+            flags = 0;
+        }
+
+        glDeleteSync(fence);
+        m_Fences[region] = nullptr;
+    }
+
     OpenGLIndexBuffer::OpenGLIndexBuffer(uint* indices, uint count)
         : m_Count(count)
     {
@@ -67,4 +134,38 @@ namespace Vanta {
         VANTA_PROFILE_RENDER_FUNCTION();
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
+
+    OpenGLIndirectBuffer::OpenGLIndirectBuffer(uint capacity)
+        : m_Capacity(capacity)
+    {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        const usize size = capacity * sizeof(DrawIndexedIndirectCommand);
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, size, nullptr, STREAMING_BUFFER_FLAGS);
+        m_Memory = (DrawIndexedIndirectCommand*)glMapNamedBufferRange(m_RendererID, 0, size, STREAMING_BUFFER_FLAGS);
+
+        VANTA_CORE_ASSERT(m_Memory, "Failed to map indirect buffer!");
+    }
+
+    OpenGLIndirectBuffer::~OpenGLIndirectBuffer() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void OpenGLIndirectBuffer::Bind() const {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_RendererID);
+    }
+
+    void OpenGLIndirectBuffer::Unbind() const {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
+    void OpenGLIndirectBuffer::SetData(const DrawIndexedIndirectCommand* commands, uint count, uint first) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        VANTA_CORE_ASSERT(first + count <= m_Capacity, "Too many indirect draw commands!");
+        memcpy(m_Memory + first, commands, count * sizeof(DrawIndexedIndirectCommand));
+    }
 }
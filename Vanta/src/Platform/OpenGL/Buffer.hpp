@@ -17,13 +17,36 @@ namespace Vanta {
 
         void SetData(const void* data, usize size) override;
 
-    private:
-        friend class OpenGLVertexArray;
+        uint32 GetRendererID() const override { return m_RendererID; }
 
+    private:
         uint m_RendererID = 0;
         BufferLayout m_Layout;
     };
 
+    /// <summary>
+    /// Streaming vertex buffer with immutable storage, mapped persistently and coherently,
+    /// so writes need no flushing. Regions are guarded by fence syncs.
+    /// </summary>
+    class OpenGLStreamingVertexBuffer : public StreamingVertexBuffer {
+    public:
+        OpenGLStreamingVertexBuffer(usize regionSize, uint regionCount);
+        virtual ~OpenGLStreamingVertexBuffer();
+
+        void Bind() const override;
+        void Unbind() const override;
+
+        uint32 GetRendererID() const override { return m_RendererID; }
+
+    protected:
+        void FenceRegion(uint region) override;
+        void WaitForRegion(uint region) override;
+
+    private:
+        uint m_RendererID = 0;
+        std::vector<void*> m_Fences; // GLsync per region, null if not fenced
+    };
+
     class OpenGLIndexBuffer : public IndexBuffer {
     public:
         OpenGLIndexBuffer(uint* indices, uint count);
@@ -40,4 +63,22 @@ namespace Vanta {
         uint m_RendererID = 0;
         uint m_Count;
     };
-}
\ No newline at end of file
+
+    class OpenGLIndirectBuffer : public IndirectBuffer {
+    public:
+        OpenGLIndirectBuffer(uint capacity);
+        virtual ~OpenGLIndirectBuffer();
+
+        virtual void Bind() const override;
+        virtual void Unbind() const override;
+
+        virtual void SetData(const DrawIndexedIndirectCommand* commands, uint count, uint first = 0) override;
+
+        virtual uint GetCapacity() const override { return m_Capacity; }
+
+    private:
+        uint m_RendererID = 0;
+        uint m_Capacity;
+        DrawIndexedIndirectCommand* m_Memory = nullptr; // Persistently mapped
+    };
+}
@@ -91,6 +91,11 @@ namespace Vanta {
         glDeleteFramebuffers(1, &m_RendererID);
         glDeleteTextures((GLsizei)m_ColorAttachments.size(), m_ColorAttachments.data());
         glDeleteTextures(1, &m_DepthAttachment);
+
+        for (auto& slot : m_Readbacks) {
+            ReleaseReadback(slot);
+            glDeleteBuffers(1, &slot.Buffer);
+        }
     }
 
     void OpenGLFramebuffer::Bind() const {
@@ -191,6 +196,88 @@ namespace Vanta {
         return pixelData;
     }
 
+    bool OpenGLFramebuffer::RequestPixels(uint32 attachmentIndex, int x, int y, uint32 width, uint32 height) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        VANTA_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Framebuffer color attachment index invalid");
+
+        // Use a free slot, or the oldest one if its read is done; never wait on the GPU here
+        ReadbackSlot* slot = &m_Readbacks[0];
+        for (auto& s : m_Readbacks) {
+            bool freer = !s.Fence && slot->Fence;
+            bool older = !s.Fence == !slot->Fence && s.Sequence < slot->Sequence;
+            if (freer || older)
+                slot = &s;
+        }
+        if (slot->Fence) {
+            GLenum status = glClientWaitSync((GLsync)slot->Fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                return false;
+            ReleaseReadback(*slot);
+        }
+
+        usize size = (usize)width * height * sizeof(int);
+        if (slot->Capacity < size) {
+            if (slot->Buffer == 0)
+                glCreateBuffers(1, &slot->Buffer);
+            glNamedBufferData(slot->Buffer, size, nullptr, GL_STREAM_READ);
+            slot->Capacity = size;
+        }
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererID);
+        glNamedFramebufferReadBuffer(m_RendererID, GL_COLOR_ATTACHMENT0 + attachmentIndex);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->Buffer);
+        glReadPixels(x, y, (GLsizei)width, (GLsizei)height, GL_RED_INTEGER, GL_INT, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        slot->Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot->Sequence = ++m_ReadbackSequence;
+        slot->X = x;
+        slot->Y = y;
+        slot->Width = width;
+        slot->Height = height;
+        return true;
+    }
+
+    bool OpenGLFramebuffer::PollPixels(FramebufferReadback& readback) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        // Fences signal in order, so the newest finished read makes every older one obsolete
+        ReadbackSlot* latest = nullptr;
+        for (auto& slot : m_Readbacks) {
+            if (!slot.Fence || (latest && slot.Sequence < latest->Sequence))
+                continue;
+
+            GLenum status = glClientWaitSync((GLsync)slot.Fence, 0, 0);
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+                latest = &slot;
+        }
+        if (!latest)
+            return false;
+
+        for (auto& slot : m_Readbacks) {
+            if (slot.Fence && slot.Sequence < latest->Sequence)
+                ReleaseReadback(slot);
+        }
+
+        usize count = (usize)latest->Width * latest->Height;
+        readback.X = latest->X;
+        readback.Y = latest->Y;
+        readback.Width = latest->Width;
+        readback.Height = latest->Height;
+        readback.Pixels.resize(count);
+        glGetNamedBufferSubData(latest->Buffer, 0, count * sizeof(int), readback.Pixels.data());
+
+        ReleaseReadback(*latest);
+        return true;
+    }
+
+    void OpenGLFramebuffer::ReleaseReadback(ReadbackSlot& slot) {
+        if (slot.Fence) {
+            glDeleteSync((GLsync)slot.Fence);
+            slot.Fence = nullptr;
+        }
+    }
+
     void OpenGLFramebuffer::ClearAttachment(uint32 attachmentIndex, int value) {
         VANTA_PROFILE_RENDER_FUNCTION();
         VANTA_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Framebuffer color attachment index invalid");
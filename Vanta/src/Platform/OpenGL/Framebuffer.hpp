@@ -16,6 +16,9 @@ namespace Vanta {
         void Resize(uint32 width, uint32 height) override;
         int ReadPixel(uint32 attachmentIndex, int x, int y) override;
 
+        bool RequestPixels(uint32 attachmentIndex, int x, int y, uint32 width, uint32 height) override;
+        bool PollPixels(FramebufferReadback& readback) override;
+
         void ClearAttachment(uint32 attachmentIndex, int value) override;
 
         uint32 GetColorAttachmentRendererID(uint32 attachmentIndex = 0) const override {
@@ -36,5 +39,23 @@ namespace Vanta {
 
         uint32 m_DepthAttachment = 0;
         FramebufferTextureParams m_DepthAttachmentParams = FramebufferTextureFormat::None;
+
+        // Pixel reads in flight, each into a pixel buffer of its own.
+        // Fences tell when the GPU has written a buffer, so it can be mapped without waiting.
+        static constexpr usize READBACK_SLOTS = 3;
+
+        struct ReadbackSlot {
+            uint Buffer = 0;
+            usize Capacity = 0;
+            void* Fence = nullptr; // GLsync, set while the read is in flight
+            uint64 Sequence = 0;
+            int X = 0, Y = 0;
+            uint32 Width = 0, Height = 0;
+        };
+
+        std::array<ReadbackSlot, READBACK_SLOTS> m_Readbacks;
+        uint64 m_ReadbackSequence = 0;
+
+        void ReleaseReadback(ReadbackSlot& slot);
     };
 }
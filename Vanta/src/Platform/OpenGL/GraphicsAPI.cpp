@@ -53,17 +53,32 @@ namespace Vanta {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
-    void OpenGLGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount) {
+    void OpenGLGraphicsAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount, uint baseVertex) {
         VANTA_PROFILE_RENDER_FUNCTION();
         vertexArray->Bind();
         GLsizei count = (GLsizei)(indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount());
-        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLint)baseVertex);
     }
 
-    void OpenGLGraphicsAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount) {
+    void OpenGLGraphicsAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint baseInstance) {
         VANTA_PROFILE_RENDER_FUNCTION();
         vertexArray->Bind();
-        glDrawArrays(GL_LINES, 0, vertexCount);
+        GLsizei count = (GLsizei)(indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount());
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLsizei)instanceCount, baseInstance);
+    }
+
+    void OpenGLGraphicsAPI::MultiDrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        vertexArray->Bind();
+        commands->Bind();
+        const void* offset = (const void*)((uintptr_t)firstCommand * sizeof(DrawIndexedIndirectCommand));
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, offset, (GLsizei)drawCount, 0);
+    }
+
+    void OpenGLGraphicsAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount, uint firstVertex) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        vertexArray->Bind();
+        glDrawArrays(GL_LINES, (GLint)firstVertex, vertexCount);
     }
 
     void OpenGLGraphicsAPI::SetLineWidth(float width) {
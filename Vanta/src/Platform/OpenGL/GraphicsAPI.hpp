@@ -14,8 +14,10 @@ namespace Vanta {
         void SetClearColor(const glm::vec4& color) override;
         void Clear() override;
 
-        void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount) override;
-        void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount) override;
+        void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount, uint baseVertex) override;
+        void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint baseInstance) override;
+        void MultiDrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand) override;
+        void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount, uint firstVertex) override;
 
         void SetLineWidth(float width) override;
     };
@@ -0,0 +1,36 @@
+#include "vantapch.hpp"
+#include "Platform/OpenGL/StorageBuffer.hpp"
+
+#include <glad/glad.h>
+
+namespace Vanta {
+
+    static constexpr GLbitfield STORAGE_BUFFER_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    OpenGLStorageBuffer::OpenGLStorageBuffer(uint32 size, uint32 binding)
+        : m_Binding(binding)
+    {
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, size, nullptr, STORAGE_BUFFER_FLAGS);
+        m_Memory = (uint8*)glMapNamedBufferRange(m_RendererID, 0, size, STORAGE_BUFFER_FLAGS);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+
+        VANTA_CORE_ASSERT(m_Memory, "Failed to map storage buffer!");
+    }
+
+    OpenGLStorageBuffer::~OpenGLStorageBuffer() {
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void OpenGLStorageBuffer::Bind() const {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_Binding, m_RendererID);
+    }
+
+    void OpenGLStorageBuffer::BindRange(uint32 offset, uint32 size) const {
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, m_Binding, m_RendererID, offset, size);
+    }
+
+    void OpenGLStorageBuffer::SetData(const void* data, uint32 size, uint32 offset) {
+        memcpy(m_Memory + offset, data, size);
+    }
+}
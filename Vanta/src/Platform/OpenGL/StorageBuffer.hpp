@@ -0,0 +1,21 @@
+#pragma once
+#include "Vanta/Render/StorageBuffer.hpp"
+
+namespace Vanta {
+
+    class OpenGLStorageBuffer : public StorageBuffer {
+    public:
+        OpenGLStorageBuffer(uint32 size, uint32 binding);
+        virtual ~OpenGLStorageBuffer();
+
+        virtual void Bind() const override;
+        virtual void BindRange(uint32 offset, uint32 size) const override;
+
+        virtual void SetData(const void* data, uint32 size, uint32 offset = 0) override;
+
+    private:
+        uint m_RendererID = 0;
+        uint32 m_Binding;
+        uint8* m_Memory = nullptr;  // Persistently mapped
+    };
+}
@@ -4,14 +4,25 @@
 #include <glad/glad.h>
 
 namespace Vanta {
-    OpenGLTexture2D::OpenGLTexture2D(uint32 width, uint32 height) :
+    OpenGLTexture2D::OpenGLTexture2D(uint32 width, uint32 height, const Path& path) :
         m_Width(width),
         m_Height(height),
         m_InternalFormat(GL_RGBA8),
-        m_DataFormat(GL_RGBA)
+        m_DataFormat(GL_RGBA),
+        m_Path(path)
     {
         VANTA_PROFILE_RENDER_FUNCTION();
+        CreateStorage();
+    }
+
+    OpenGLTexture2D::OpenGLTexture2D(const Path& path)
+        : m_Path(path)
+    {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        SetImage(IO::Image(path));
+    }
 
+    void OpenGLTexture2D::CreateStorage() {
         glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
 
         // Create texture storage
@@ -26,62 +37,152 @@ namespace Vanta {
         glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
 
-    OpenGLTexture2D::OpenGLTexture2D(const Path& path)
-        : m_Path(path)
-    {
+    OpenGLTexture2D::~OpenGLTexture2D() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glDeleteTextures(1, &m_RendererID);
+    }
+
+    void OpenGLTexture2D::Bind(uint slot) const {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        glBindTextureUnit(slot, m_RendererID);
+    }
+
+    void OpenGLTexture2D::SetData(const void* data, usize size) {
         VANTA_PROFILE_RENDER_FUNCTION();
+        auto pixel = m_DataFormat == GL_RGBA ? 4 : 3;
+        VANTA_ASSERT(size == (m_Width * m_Height * pixel), "Image data doesn't match texture properties!");
+        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        //glGenerateTextureMipmap(m_RendererID);
+        m_Opaque = IsOpaqueData(data, size, GetFormat());
+        m_Revision++;
+    }
 
-        auto image = IO::Image(path);
+    void OpenGLTexture2D::SetImage(const IO::Image& image) {
+        VANTA_PROFILE_RENDER_FUNCTION();
 
         if (!image)
             return;
 
-        m_Width = image.Width;
-        m_Height = image.Height;
-
+        uint internalFormat = 0;
+        uint dataFormat = 0;
         if (image.Channels == 4) {
-            m_InternalFormat = GL_RGBA8;
-            m_DataFormat = GL_RGBA;
+            internalFormat = GL_RGBA8;
+            dataFormat = GL_RGBA;
         }
         else if (image.Channels == 3) {
-            m_InternalFormat = GL_RGB8;
-            m_DataFormat = GL_RGB;
+            internalFormat = GL_RGB8;
+            dataFormat = GL_RGB;
         }
 
-        VANTA_ASSERT(m_InternalFormat & m_DataFormat, "Unsupported image format: '{}'", path.string());
+        VANTA_ASSERT(internalFormat & dataFormat, "Unsupported image format: '{}'", m_Path.string());
 
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+        // Storage is immutable, so a different size or format needs a new texture
+        if (!m_RendererID || m_Width != image.Width || m_Height != image.Height || m_InternalFormat != internalFormat) {
+            glDeleteTextures(1, &m_RendererID);
+            m_RendererID = 0;
+
+            m_Width = image.Width;
+            m_Height = image.Height;
+            m_InternalFormat = internalFormat;
+            CreateStorage();
+        }
+        m_DataFormat = dataFormat;
+
+        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, image.Data);
+        //glGenerateTextureMipmap(m_RendererID);
+
+        m_Opaque = IsOpaqueData(image.Data, (usize)m_Width * m_Height * image.Channels, GetFormat());
+        m_Revision++;
+    }
+
+    TextureFormat OpenGLTexture2D::GetFormat() const {
+        switch (m_InternalFormat) {
+        case GL_RGB8:  return TextureFormat::RGB8;
+        case GL_RGBA8: return TextureFormat::RGBA8;
+        default:       return TextureFormat::None;
+        }
+    }
+
+    static GLenum OpenGLInternalFormat(TextureFormat format) {
+        switch (format) {
+        case TextureFormat::RGB8:  return GL_RGB8;
+        case TextureFormat::RGBA8: return GL_RGBA8;
+        default:
+            VANTA_UNREACHABLE("Invalid texture format!");
+            return 0;
+        }
+    }
+
+    OpenGLTexture2DArray::OpenGLTexture2DArray(uint32 width, uint32 height, uint32 layerCount, TextureFormat format) :
+        m_Width(width),
+        m_Height(height),
+        m_LayerCount(layerCount),
+        m_Format(format)
+    {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_RendererID);
 
         // Create texture storage
-        glTextureStorage2D(m_RendererID, 1, m_InternalFormat, image.Width, image.Height);
+        glTextureStorage3D(m_RendererID, 1, OpenGLInternalFormat(m_Format), m_Width, m_Height, m_LayerCount);
 
-        // Set wrapping mode
+        // Match the wrapping and filtering of 2D textures
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
-
-        // Set filtering mode
         glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
 
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, image.Data);
-        //glGenerateTextureMipmap(m_RendererID);
+    OpenGLTexture2DArray::OpenGLTexture2DArray(const Texture2D& view) :
+        m_Width(view.GetWidth()),
+        m_Height(view.GetHeight()),
+        m_LayerCount(1),
+        m_Format(view.GetFormat())
+    {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        // Views need a texture name that hasn't been given storage yet
+        glGenTextures(1, &m_RendererID);
+        glTextureView(m_RendererID, GL_TEXTURE_2D_ARRAY, view.GetRendererID(), OpenGLInternalFormat(m_Format), 0, 1, 0, 1);
+
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     }
 
-    OpenGLTexture2D::~OpenGLTexture2D() {
+    OpenGLTexture2DArray::~OpenGLTexture2DArray() {
         VANTA_PROFILE_RENDER_FUNCTION();
         glDeleteTextures(1, &m_RendererID);
     }
 
-    void OpenGLTexture2D::Bind(uint slot) const {
+    void OpenGLTexture2DArray::Bind(uint slot) const {
         VANTA_PROFILE_RENDER_FUNCTION();
         glBindTextureUnit(slot, m_RendererID);
     }
 
-    void OpenGLTexture2D::SetData(const void* data, usize size) {
+    void OpenGLTexture2DArray::CopyLayer(uint32 layer, const Texture2D& source) {
         VANTA_PROFILE_RENDER_FUNCTION();
-        auto pixel = m_DataFormat == GL_RGBA ? 4 : 3;
-        VANTA_ASSERT(size == (m_Width * m_Height * pixel), "Image data doesn't match texture properties!");
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
-        //glGenerateTextureMipmap(m_RendererID);
+        VANTA_CORE_ASSERT(layer < m_LayerCount, "Texture array layer out of range!");
+        VANTA_CORE_ASSERT(source.GetWidth() == m_Width && source.GetHeight() == m_Height && source.GetFormat() == m_Format,
+            "Texture doesn't match texture array properties!");
+
+        glCopyImageSubData(source.GetRendererID(), GL_TEXTURE_2D, 0, 0, 0, 0,
+                           m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer,
+                           m_Width, m_Height, 1);
+    }
+
+    void OpenGLTexture2DArray::CopyLayers(const Texture2DArray& source, uint32 layerCount) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        VANTA_CORE_ASSERT(layerCount <= m_LayerCount && layerCount <= source.GetLayerCount(), "Texture array layer out of range!");
+        VANTA_CORE_ASSERT(source.GetWidth() == m_Width && source.GetHeight() == m_Height && source.GetFormat() == m_Format,
+            "Texture arrays don't match!");
+
+        if (layerCount == 0)
+            return;
+
+        glCopyImageSubData(source.GetRendererID(), GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+                           m_RendererID, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+                           m_Width, m_Height, layerCount);
     }
 }
@@ -5,13 +5,14 @@ namespace Vanta {
 
     class OpenGLTexture2D : public Texture2D {
     public:
-        OpenGLTexture2D(uint32 width, uint32 height);
+        OpenGLTexture2D(uint32 width, uint32 height, const Path& path = Path());
         OpenGLTexture2D(const Path& path);
         ~OpenGLTexture2D();
 
         void Bind(uint slot) const override;
 
         void SetData(const void* data, usize size) override;
+        void SetImage(const IO::Image& image) override;
 
         bool IsValid() const override { return m_RendererID != 0; }
 
@@ -19,6 +20,7 @@ namespace Vanta {
 
         uint32 GetWidth() const override  { return m_Width; }
         uint32 GetHeight() const override { return m_Height; }
+        TextureFormat GetFormat() const override;
 
         uint32 GetRendererID() const override { return m_RendererID; };
 
@@ -37,5 +39,33 @@ namespace Vanta {
         uint m_DataFormat = 0;
 
         Path m_Path;
+
+        void CreateStorage();
+    };
+
+    class OpenGLTexture2DArray : public Texture2DArray {
+    public:
+        OpenGLTexture2DArray(uint32 width, uint32 height, uint32 layerCount, TextureFormat format);
+        OpenGLTexture2DArray(const Texture2D& view);
+        ~OpenGLTexture2DArray();
+
+        void Bind(uint slot) const override;
+
+        uint32 GetWidth() const override      { return m_Width; }
+        uint32 GetHeight() const override     { return m_Height; }
+        uint32 GetLayerCount() const override { return m_LayerCount; }
+        TextureFormat GetFormat() const override { return m_Format; }
+
+        uint32 GetRendererID() const override { return m_RendererID; }
+
+        void CopyLayer(uint32 layer, const Texture2D& source) override;
+        void CopyLayers(const Texture2DArray& source, uint32 layerCount) override;
+
+    private:
+        uint m_RendererID = 0;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        uint32 m_LayerCount = 0;
+        TextureFormat m_Format = TextureFormat::None;
     };
 }
@@ -21,6 +21,9 @@ namespace Vanta {
         case Shader::DataType::Float2: return GL_FLOAT;
         case Shader::DataType::Float3: return GL_FLOAT;
         case Shader::DataType::Float4: return GL_FLOAT;
+        case Shader::DataType::UNorm4x8:  return GL_UNSIGNED_BYTE;
+        case Shader::DataType::UNorm2x16: return GL_UNSIGNED_SHORT;
+        case Shader::DataType::Half2x16:  return GL_HALF_FLOAT;
         case Shader::DataType::Mat3:   return GL_FLOAT;
         case Shader::DataType::Mat4:   return GL_FLOAT;
         case Shader::DataType::Bool:   return GL_BOOL;
@@ -55,25 +58,34 @@ namespace Vanta {
 
         VANTA_CORE_ASSERT(!vertexBuffer->GetLayout().GetElements().empty(), "Vertex buffer missing layout!");
 
-        auto vbo = RefCast<OpenGLVertexBuffer>(vertexBuffer);
+        const uint vbo = vertexBuffer->GetRendererID();
 
         const auto& layout = vertexBuffer->GetLayout();
+        const GLuint divisor = (layout.GetStepRate() == BufferLayout::StepRate::PerInstance) ? 1 : 0;
 
         for (const auto& e : layout.GetElements()) {
             uint itemCount = e.Type.ItemCount();
             GLenum type = OpenGLDataType(e.Type);
             GLboolean normalized = e.Normalized ? GL_TRUE : GL_FALSE;
-           
+
+            // Unsigned normalized types are read in [0, 1]
+            if (e.Type == Shader::DataType::UNorm4x8 || e.Type == Shader::DataType::UNorm2x16)
+                normalized = GL_TRUE;
+
             switch (e.Type) {
-            case Shader::DataType::Float:  [[fallthrough]];
-            case Shader::DataType::Float2: [[fallthrough]];
-            case Shader::DataType::Float3: [[fallthrough]];
-            case Shader::DataType::Float4: {
+            case Shader::DataType::Float:     [[fallthrough]];
+            case Shader::DataType::Float2:    [[fallthrough]];
+            case Shader::DataType::Float3:    [[fallthrough]];
+            case Shader::DataType::Float4:    [[fallthrough]];
+            case Shader::DataType::UNorm4x8:  [[fallthrough]];
+            case Shader::DataType::UNorm2x16: [[fallthrough]];
+            case Shader::DataType::Half2x16: {
                 glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
-                glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo->m_RendererID, e.Offset, (uint)layout.GetStride());
+                glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo, e.Offset, (uint)layout.GetStride());
                 glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex, itemCount, type, normalized, 0);
 
                 glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, m_VertexBufferIndex);
+                glVertexArrayBindingDivisor(m_RendererID, m_VertexBufferIndex, divisor);
                 m_VertexBufferIndex++;
                 break;
             }
@@ -88,10 +100,11 @@ namespace Vanta {
             case Shader::DataType::UInt4: [[fallthrough]];
             case Shader::DataType::Bool: {
                 glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
-                glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo->m_RendererID, e.Offset, (uint)layout.GetStride());
+                glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo, e.Offset, (uint)layout.GetStride());
                 glVertexArrayAttribIFormat(m_RendererID, m_VertexBufferIndex, itemCount, type, 0);
 
                 glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, m_VertexBufferIndex);
+                glVertexArrayBindingDivisor(m_RendererID, m_VertexBufferIndex, divisor);
                 m_VertexBufferIndex++;
                 break;
             }
@@ -104,7 +117,7 @@ namespace Vanta {
                     glEnableVertexArrayAttrib(m_VertexBufferIndex, m_VertexBufferIndex);
 
                     glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
-                    glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo->m_RendererID, offset, (GLsizei)layout.GetStride());
+                    glVertexArrayVertexBuffer(m_RendererID, m_VertexBufferIndex, vbo, offset, (GLsizei)layout.GetStride());
                     glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex, itemCount, type, normalized, 0);
 
                     glVertexAttribDivisor(m_VertexBufferIndex, 1);
@@ -6,23 +6,31 @@
 
 namespace Vanta {
     void Input::PollInputs() {
+        if (Engine::Get().IsHeadless())
+            return;
         glfwPollEvents();
     }
 
     bool Input::IsKeyPressed(KeyCode key) {
         auto window = static_cast<GLFWwindow*>(Engine::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return false;
         auto state = glfwGetKey(window, static_cast<int>(key));
         return state == GLFW_PRESS || state == GLFW_REPEAT;
     }
     
     bool Input::IsMouseButtonPressed(MouseCode button) {
         auto window = static_cast<GLFWwindow*>(Engine::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return false;
         auto state = glfwGetMouseButton(window, static_cast<int>(button));
         return state == GLFW_PRESS;
     }
 
     std::pair<float, float> Input::GetMousePos() {
         auto window = static_cast<GLFWwindow*>(Engine::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return { 0.f, 0.f };
         double xPos, yPos;
         glfwGetCursorPos(window, &xPos, &yPos);
         return { (float)xPos, (float)yPos };
@@ -0,0 +1,53 @@
+#include "vantapch.hpp"
+#include "Vanta/IO/File.hpp"
+
+#include <Windows.h>
+
+namespace Vanta {
+    namespace IO {
+        MappedFile::MappedFile(const Path& path) {
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                VANTA_ERROR("Failed to open file: '{}'", path);
+                return;
+            }
+
+            // Empty files can't be mapped
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return;
+            }
+
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping) {
+                VANTA_ERROR("Failed to map file: '{}'", path);
+                CloseHandle(file);
+                return;
+            }
+
+            void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (!view) {
+                VANTA_ERROR("Failed to map file: '{}'", path);
+                CloseHandle(mapping);
+                CloseHandle(file);
+                return;
+            }
+
+            m_File = file;
+            m_Mapping = mapping;
+            m_Data = (const uint8*)view;
+            m_Size = (usize)size.QuadPart;
+        }
+
+        MappedFile::~MappedFile() {
+            if (m_Data)
+                UnmapViewOfFile(m_Data);
+            if (m_Mapping)
+                CloseHandle((HANDLE)m_Mapping);
+            if (m_File)
+                CloseHandle((HANDLE)m_File);
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#include "vantapch.hpp"
+#include "Vanta/Asset/AssetManager.hpp"
+#include "Vanta/Core/Engine.hpp"
+#include "Vanta/Core/Fibers.hpp"
+#include "Vanta/Project/Project.hpp"
+
+namespace Vanta {
+
+    // Texture being loaded in the background
+    struct TextureLoad {
+        Path Filepath;
+        std::string Name;
+        std::weak_ptr<Texture2D> Texture;
+        Box<IO::Image> Image; // Set once decoded
+    };
+
+    struct AssetData {
+        std::mutex Mutex;
+        std::unordered_map<std::string, std::weak_ptr<Texture2D>> Textures; // Keyed by generic path string
+        usize CollectThreshold = 64; // Expired entries are swept once the map grows past this
+
+        JobCounter Loads;
+        std::vector<Box<TextureLoad>> Decoded; // Waiting to be uploaded on the main thread
+        std::atomic<usize> Loading = 0;
+    };
+
+    static AssetData s_Data;
+
+    static void UploadTextures() {
+        VANTA_PROFILE_FUNCTION();
+
+        std::vector<Box<TextureLoad>> decoded;
+        {
+            std::lock_guard lock(s_Data.Mutex);
+            decoded.swap(s_Data.Decoded);
+        }
+
+        for (auto& load : decoded) {
+            if (Ref<Texture2D> texture = load->Texture.lock()) {
+                if (load->Image && *load->Image) {
+                    texture->SetImage(*load->Image);
+                }
+                else {
+                    // Stop sharing the placeholder, so the next request tries again
+                    std::lock_guard lock(s_Data.Mutex);
+                    auto it = s_Data.Textures.find(load->Name);
+                    if (it != s_Data.Textures.end() && it->second.lock() == texture)
+                        s_Data.Textures.erase(it);
+                }
+            }
+            s_Data.Loading--;
+        }
+    }
+
+    static void DecodeTexture(void* data, usize) {
+        VANTA_PROFILE_FUNCTION();
+
+        Box<TextureLoad> load(static_cast<TextureLoad*>(data));
+
+        // Skip decoding textures everyone has let go of already
+        if (!load->Texture.expired())
+            load->Image = NewBox<IO::Image>(load->Filepath);
+
+        bool first = false;
+        {
+            std::lock_guard lock(s_Data.Mutex);
+            first = s_Data.Decoded.empty();
+            s_Data.Decoded.push_back(std::move(load));
+        }
+
+        // A single upload takes everything decoded by the time it runs
+        if (first)
+            Engine::Get().SubmitToMainThread(&UploadTextures);
+    }
+
+    // Drop expired entries. Expects the mutex to be held.
+    static void CollectLocked() {
+        std::erase_if(s_Data.Textures, [](const auto& entry) { return entry.second.expired(); });
+        s_Data.CollectThreshold = std::max<usize>(64, s_Data.Textures.size() * 2);
+    }
+
+    Ref<Texture2D> AssetManager::GetTexture(const Path& path) {
+        VANTA_PROFILE_FUNCTION();
+        VANTA_CORE_ASSERT(Engine::Get().IsMainThread(), "Textures can only be created on the main thread!");
+
+        const Path key = GetKey(path);
+        const std::string name = key.generic_string();
+
+        {
+            std::lock_guard lock(s_Data.Mutex);
+            auto it = s_Data.Textures.find(name);
+            if (it != s_Data.Textures.end()) {
+                if (Ref<Texture2D> texture = it->second.lock())
+                    return texture;
+            }
+        }
+
+        // Load outside the lock, so lookups from other threads aren't held up
+        Ref<Texture2D> texture = Texture2D::Create(key);
+        if (!texture->IsValid())
+            return texture;
+
+        std::lock_guard lock(s_Data.Mutex);
+        auto& entry = s_Data.Textures[name];
+        if (Ref<Texture2D> existing = entry.lock())
+            return existing;
+        entry = texture;
+
+        if (s_Data.Textures.size() > s_Data.CollectThreshold)
+            CollectLocked();
+
+        return texture;
+    }
+
+    Ref<Texture2D> AssetManager::LoadTexture(const Path& path) {
+        VANTA_PROFILE_FUNCTION();
+        VANTA_CORE_ASSERT(Engine::Get().IsMainThread(), "Textures can only be created on the main thread!");
+
+        const Path key = GetKey(path);
+        const std::string name = key.generic_string();
+
+        Ref<Texture2D> texture;
+        {
+            std::lock_guard lock(s_Data.Mutex);
+            auto& entry = s_Data.Textures[name];
+            if (Ref<Texture2D> existing = entry.lock())
+                return existing;
+
+            texture = Texture2D::CreatePlaceholder(key);
+            entry = texture;
+
+            if (s_Data.Textures.size() > s_Data.CollectThreshold)
+                CollectLocked();
+        }
+
+        // Dispatch outside the lock, since a full job queue runs the job right here
+        s_Data.Loading++;
+        Box<TextureLoad> load = NewBox<TextureLoad>();
+        load->Filepath = key;
+        load->Name = name;
+        load->Texture = texture;
+        Fibers::Dispatch(s_Data.Loads, &DecodeTexture, load.release());
+
+        return texture;
+    }
+
+    usize AssetManager::GetLoadingCount() {
+        return s_Data.Loading;
+    }
+
+    void AssetManager::FinishLoading() {
+        VANTA_PROFILE_FUNCTION();
+        VANTA_CORE_ASSERT(Engine::Get().IsMainThread(), "Textures can only be uploaded on the main thread!");
+        s_Data.Loads.Wait();
+        UploadTextures();
+    }
+
+    Ref<Texture2D> AssetManager::FindTexture(const Path& path) {
+        const std::string name = GetKey(path).generic_string();
+
+        std::lock_guard lock(s_Data.Mutex);
+        auto it = s_Data.Textures.find(name);
+        return it != s_Data.Textures.end() ? it->second.lock() : nullptr;
+    }
+
+    usize AssetManager::GetTextureCount() {
+        std::lock_guard lock(s_Data.Mutex);
+        return std::count_if(s_Data.Textures.begin(), s_Data.Textures.end(),
+            [](const auto& entry) { return !entry.second.expired(); });
+    }
+
+    void AssetManager::Collect() {
+        std::lock_guard lock(s_Data.Mutex);
+        CollectLocked();
+    }
+
+    Path AssetManager::GetKey(const Path& path) {
+        Path absolute = path;
+        if (path.is_relative()) {
+            absolute = Project::GetActive()
+                ? Project::GetAssetPath(path)
+                : std::filesystem::absolute(path);
+        }
+        return absolute.lexically_normal();
+    }
+}
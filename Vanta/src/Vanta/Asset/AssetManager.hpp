@@ -0,0 +1,70 @@
+#pragma once
+#include "Vanta/Render/Texture.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Shares loaded assets between everything that uses them, so each file is only loaded once
+    /// for as long as something holds on to it.
+    ///
+    /// Assets are keyed by their normalized absolute path.
+    /// The manager only holds weak references; once the last user lets go of an asset it's freed,
+    /// and the next request loads it again.
+    /// Looking up textures is safe from any thread, but anything that may create one
+    /// makes graphics calls, and has to be called on the main thread.
+    /// </summary>
+    class AssetManager {
+    public:
+        /// <summary>
+        /// Get the texture loaded from a file, loading it if no one holds it yet.
+        /// Relative paths are relative to the active project's asset directory.
+        /// Textures that fail to load are returned, but not shared.
+        /// Has to be called on the main thread.
+        /// </summary>
+        static Ref<Texture2D> GetTexture(const Path& path);
+
+        /// <summary>
+        /// Get the texture loaded from a file, loading it in the background if no one holds it yet.
+        /// Until the image is decoded on a fiber worker and uploaded on the main thread,
+        /// the texture is a white placeholder.
+        /// Textures that fail to load stay placeholders, and aren't shared.
+        /// Has to be called on the main thread.
+        /// </summary>
+        static Ref<Texture2D> LoadTexture(const Path& path);
+
+        /// <summary>
+        /// Number of textures still being loaded in the background.
+        /// </summary>
+        static usize GetLoadingCount();
+
+        /// <summary>
+        /// Wait for every texture being loaded in the background, and upload them.
+        /// Has to be called on the main thread.
+        /// </summary>
+        static void FinishLoading();
+
+        /// <summary>
+        /// Get the texture loaded from a file, if someone still holds it.
+        /// </summary>
+        static Ref<Texture2D> FindTexture(const Path& path);
+
+        /// <summary>
+        /// Number of textures currently shared.
+        /// </summary>
+        static usize GetTextureCount();
+
+        /// <summary>
+        /// Forget textures no one holds anymore.
+        /// Happens on its own as textures are requested, this only frees the bookkeeping sooner.
+        /// </summary>
+        static void Collect();
+
+        /// <summary>
+        /// Path a file is shared under.
+        /// </summary>
+        static Path GetKey(const Path& path);
+
+    private:
+        AssetManager() = delete;
+    };
+}
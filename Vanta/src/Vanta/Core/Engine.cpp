@@ -14,7 +14,8 @@ namespace Vanta {
 
     Engine::Engine(const EngineParams& params) :
         m_CommandLineArgs(params.CommandLineArgs),
-        m_WorkingDirectory(params.WorkingDirectory)
+        m_WorkingDirectory(params.WorkingDirectory),
+        m_Headless(params.Headless)
     {
         VANTA_PROFILE_FUNCTION();
 
@@ -25,6 +26,9 @@ namespace Vanta {
         if (!params.WorkingDirectory.empty())
             std::filesystem::current_path(params.WorkingDirectory);
 
+        if (m_Headless)
+            GraphicsAPI::SetAPI(GraphicsAPI::None);
+
         m_Window = Window::Create(params.Window);
         m_Window->SetEventCallback(EVENT_METHOD(Engine::OnEvent));
 
@@ -32,8 +36,10 @@ namespace Vanta {
         Renderer::Init();
         Scripts::ScriptManager::Init();
 
-        m_GUILayer = new GUILayer();
-        PushOverlay(m_GUILayer);
+        if (!m_Headless) {
+            m_GUILayer = new GUILayer();
+            PushOverlay(m_GUILayer);
+        }
     }
 
     Engine::~Engine() {
@@ -59,12 +65,15 @@ namespace Vanta {
                 layer->OnUpdate(m_DeltaTime);
             }
 
-            m_GUILayer->Begin();
-            for (Layer* layer : m_LayerStack) {
-                layer->OnGUIRender();
+            if (m_GUILayer) {
+                m_GUILayer->Begin();
+                for (Layer* layer : m_LayerStack) {
+                    layer->OnGUIRender();
+                }
+                m_GUILayer->End();
             }
-            m_GUILayer->End();
 
+            Renderer::FrameEnd();
             m_Window->Update();
 
             Time newFrameTime;
@@ -153,11 +162,15 @@ namespace Vanta {
     }
 
     void Engine::ExectuteMainThreadQueue() {
-        std::scoped_lock<std::mutex> lock(m_MainThreadQueueMutex);
+        // Take the queue and run it unlocked, so the funcs can be slow
+        // without stalling threads that submit more work meanwhile
+        std::vector<std::function<void()>> queue;
+        {
+            std::scoped_lock<std::mutex> lock(m_MainThreadQueueMutex);
+            queue.swap(m_MainThreadQueue);
+        }
 
-        for (auto& func : m_MainThreadQueue)
+        for (auto& func : queue)
             func();
-
-        m_MainThreadQueue.clear();
     }
 }
@@ -28,6 +28,11 @@ namespace Vanta {
         CommandLineArguments CommandLineArgs;
         Path WorkingDirectory = std::filesystem::current_path();
         WindowParams Window;
+        /// <summary>
+        /// Run without a window or GPU: uses a null window and the GraphicsAPI::None backend.
+        /// No GUI layer is created. Useful for tests, servers and benchmarking the game loop.
+        /// </summary>
+        bool Headless = false;
     };
 
     class Engine {
@@ -53,6 +58,7 @@ namespace Vanta {
         static Path RuntimeScriptDirectory(Scripts::ScriptType type) { return RuntimeScriptDirectory() / Scripts::ScriptTypeToString(type); }
 
         bool IsMinimized() const { return m_Minimized; }
+        bool IsHeadless() const  { return m_Headless; }
 
         static Engine& Get()      { return *s_Instance; }
         Window& GetWindow()       { return *m_Window; }
@@ -60,12 +66,17 @@ namespace Vanta {
 
         void SubmitToMainThread(const std::function<void()>& func);
 
+        /// <summary>
+        /// Whether the caller runs on the thread the engine was created on, which owns the graphics context.
+        /// </summary>
+        bool IsMainThread() const { return std::this_thread::get_id() == m_MainThreadID; }
+
     private:
         static Engine* s_Instance;
 
         Box<Window> m_Window;
         LayerStack m_LayerStack;
-        GUILayer* m_GUILayer;
+        GUILayer* m_GUILayer = nullptr;
 
         Path m_WorkingDirectory;
         CommandLineArguments m_CommandLineArgs;
@@ -74,7 +85,9 @@ namespace Vanta {
         double m_DeltaTime;
         bool m_Running = true;
         bool m_Minimized = false;
+        bool m_Headless = false;
 
+        std::thread::id m_MainThreadID = std::this_thread::get_id();
         std::vector<std::function<void()>> m_MainThreadQueue;
         std::mutex m_MainThreadQueueMutex;
 
@@ -6,19 +6,49 @@ namespace Vanta {
     uint Fibers::THREAD_COUNT = std::thread::hardware_concurrency();
 
     boost::thread_group Fibers::s_Workers;
-    std::stack<Fibers::FiberList> Fibers::s_JobStack;
+    std::vector<Fiber> Fibers::s_JobFibers;
+    JobQueue<Fibers::Job, Fibers::JOB_QUEUE_CAPACITY> Fibers::s_Jobs;
 
     static std::mutex s_InitMutex;
     static uint32_t s_InitCount = 0;
     static fibers::mutex s_StopMutex;
     static fibers::condition_variable s_StopCondition;
 
+    // Job fibers sleep here while the queue is empty
+    static fibers::mutex s_JobMutex;
+    static fibers::condition_variable s_JobCondition;
+    static std::atomic<usize> s_SleepingJobFibers = 0;
+    static bool s_StoppingJobs = false;
+    static std::atomic<bool> s_JobsRunning = false;
+
     static void WorkerRun() {
         // Continue to work while waiting on the stop condition
         std::unique_lock<fibers::mutex> lock(s_StopMutex);
         s_StopCondition.wait(lock);
     }
 
+    void JobCounter::Done() {
+        // Not the last job, nobody can be woken up
+        usize pending = m_Pending.load(std::memory_order_relaxed);
+        while (pending > 1) {
+            if (m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+                return;
+        }
+
+        // Finish under the lock, so a waiter can't observe zero and destroy the counter while it's being notified
+        std::unique_lock<fibers::mutex> lock(m_Mutex);
+        if (m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_Condition.notify_all();
+    }
+
+    void JobCounter::Wait() {
+        // Help out instead of idling, this also keeps threads outside the pool from starving
+        while (!IsDone() && Fibers::RunQueuedJob()) {}
+
+        std::unique_lock<fibers::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this]() { return IsDone(); });
+    }
+
     void Fibers::Init() {
         VANTA_PROFILE_FUNCTION();
 
@@ -26,16 +56,26 @@ namespace Vanta {
         if (s_InitCount++ > 0)
             return;
 
+        s_StoppingJobs = false;
+        s_JobsRunning = true;
+
         // Spawn worker threads (start at 1 because the caller will be one of the workers)
         for (uint i = 1; i < THREAD_COUNT; i++) {
             s_Workers.create_thread([&]() {
                 fibers::use_scheduling_algorithm<fibers::algo::work_stealing>(THREAD_COUNT, true);
+
+                std::vector<Fiber> jobFibers;
+                SpawnJobFibers(jobFibers);
                 WorkerRun();
+
+                for (auto& fiber : jobFibers)
+                    fiber.join();
             });
         }
 
         // Set scheduling for the calling thread as well
         fibers::use_scheduling_algorithm<fibers::algo::work_stealing>(THREAD_COUNT, true);
+        SpawnJobFibers(s_JobFibers);
     }
 
     void Fibers::Shutdown() {
@@ -45,6 +85,17 @@ namespace Vanta {
         if (s_InitCount == 0 || --s_InitCount > 0)
             return;
 
+        {
+            // Let job fibers drain the queue and exit, before their threads go away
+            std::unique_lock<fibers::mutex> jobLock(s_JobMutex);
+            s_StoppingJobs = true;
+            s_JobCondition.notify_all();
+        }
+
+        for (auto& fiber : s_JobFibers)
+            fiber.join();
+        s_JobFibers.clear();
+
         {
             // Notify worker threads about shutdown, and wait for them to exit
             std::unique_lock<fibers::mutex> stopLock(s_StopMutex);
@@ -52,19 +103,80 @@ namespace Vanta {
         }
 
         s_Workers.join_all();
+        s_JobsRunning = false;
     }
 
-    void Fibers::Begin(usize jobCount) {
-        VANTA_PROFILE_FUNCTION();
-        auto fibers = FiberList();
-        fibers.reserve(jobCount);
-        s_JobStack.push(std::move(fibers));
+    void Fibers::Dispatch(JobCounter& counter, JobFunction fn, void* data, usize jobCount) {
+        if (jobCount == 0)
+            return;
+
+        counter.Add(jobCount);
+
+        for (usize i = 0; i < jobCount; i++) {
+            Job job{ fn, data, i, &counter };
+            if (!s_JobsRunning || !s_Jobs.Push(job))
+                RunJob(job);
+        }
+
+        // Pairs with the fence in JobFiberRun; either a sleeping fiber is seen here,
+        // or the fiber sees the new jobs before going to sleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (s_SleepingJobFibers.load(std::memory_order_relaxed) > 0) {
+            std::unique_lock<fibers::mutex> lock(s_JobMutex);
+            if (jobCount > 1)
+                s_JobCondition.notify_all();
+            else
+                s_JobCondition.notify_one();
+        }
     }
 
-    void Fibers::End() {
-        VANTA_PROFILE_FUNCTION();
-        for (auto& fiber : s_JobStack.top())
-            fiber.join();
-        s_JobStack.pop();
+    void Fibers::RunJob(const Job& job) {
+        job.Function(job.Data, job.Index);
+        job.Counter->Done();
+    }
+
+    bool Fibers::RunQueuedJob() {
+        Job job;
+        if (!s_Jobs.Pop(job))
+            return false;
+
+        RunJob(job);
+        return true;
+    }
+
+    void Fibers::SpawnJobFibers(std::vector<Fiber>& jobFibers) {
+        // Job fibers live for the whole run, so their stacks are allocated once, here.
+        // Each stack ends in a guard page, so an overflow faults instead of corrupting the heap;
+        // pages are only committed as they're touched, so the reserve costs address space alone.
+        jobFibers.reserve(JOB_FIBERS_PER_THREAD);
+        for (usize i = 0; i < JOB_FIBERS_PER_THREAD; i++)
+            jobFibers.emplace_back(std::allocator_arg, fibers::protected_fixedsize_stack(JOB_STACK_SIZE), &Fibers::JobFiberRun);
+    }
+
+    void Fibers::JobFiberRun() {
+        Job job;
+        for (;;) {
+            if (s_Jobs.Pop(job)) {
+                RunJob(job);
+                continue;
+            }
+
+            std::unique_lock<fibers::mutex> lock(s_JobMutex);
+            if (s_StoppingJobs)
+                return;
+
+            s_SleepingJobFibers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (s_Jobs.Pop(job)) {
+                s_SleepingJobFibers.fetch_sub(1, std::memory_order_relaxed);
+                lock.unlock();
+                RunJob(job);
+                continue;
+            }
+
+            s_JobCondition.wait(lock);
+            s_SleepingJobFibers.fetch_sub(1, std::memory_order_relaxed);
+        }
     }
 }
@@ -1,10 +1,13 @@
 #pragma once
+#include "Vanta/Core/JobQueue.hpp"
+
 #include <boost/fiber/algo/round_robin.hpp>
 #include <boost/fiber/algo/shared_work.hpp>
 #include <boost/fiber/algo/work_stealing.hpp>
-#include <boost/fiber/barrier.hpp>
 #include <boost/fiber/condition_variable.hpp>
 #include <boost/fiber/fiber.hpp>
+#include <boost/fiber/mutex.hpp>
+#include <boost/fiber/protected_fixedsize_stack.hpp>
 #include <boost/thread/thread.hpp>
 
 namespace fibers = boost::fibers;
@@ -14,57 +17,91 @@ namespace Vanta {
 
     using Fiber = fibers::fiber;
 
+    /// <summary>
+    /// Completion handle for a group of jobs.
+    /// Jobs dispatched against a counter increment it, and decrement it once done.
+    /// Waiting runs queued jobs on the caller until none are left, and then suspends only the calling fiber,
+    /// so the thread keeps executing other jobs meanwhile.
+    /// Must outlive every job dispatched against it, which `Wait` guarantees.
+    /// </summary>
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        ~JobCounter() { Wait(); }
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        void Add(usize count) { m_Pending.fetch_add(count, std::memory_order_acq_rel); }
+        void Done();
+
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+        /// <summary>
+        /// Wait for all jobs dispatched against this counter to complete.
+        /// </summary>
+        void Wait();
+
+    private:
+        std::atomic<usize> m_Pending = 0;
+        fibers::mutex m_Mutex;
+        fibers::condition_variable m_Condition;
+    };
+
     class Fibers {
     public:
+        using JobFunction = void(*)(void* data, usize index);
+
         static void Init();
         static void Shutdown();
 
         /// <summary>
-        /// Prepare for a certain number of jobs that will need to be executed.
-        /// </summary>
-        /// <param name="jobCount">Number of jobs to prepare. Each job is executed by one fiber.</param>
-        static void Begin(usize jobCount);
-        /// <summary>
-        /// Collect and destroy fibers working on previously started jobs. Doesn't guarantee jobs are done.
+        /// Queue jobs for the engine's job fibers. Safe to call from any thread or fiber.
+        /// Nothing is allocated; jobs are plain records in a fixed-size lock-free queue,
+        /// executed by a fixed set of fibers created at startup.
+        /// If the queue is full, the job is executed immediately on the calling thread.
         /// </summary>
-        static void End();
+        /// <param name="counter">Counter tracking completion of the jobs.</param>
+        /// <param name="fn">Function to call for every job.</param>
+        /// <param name="data">User data passed to every job. Must outlive the jobs.</param>
+        /// <param name="jobCount">Number of jobs; each is passed its index.</param>
+        static void Dispatch(JobCounter& counter, JobFunction fn, void* data, usize jobCount = 1);
 
         /// <summary>
-        /// Spawn a fiber that will execute a given function with the given arguments.
+        /// Queue `jobCount` invocations of a callable, each passed its job index.
+        /// The callable is referenced, not copied, and must outlive the jobs.
         /// </summary>
-        /// <param name="fn">The executable function.</param>
-        /// <param name="args">Arguments to pass to the function.</param>
-        template<typename Fn, typename... Args>
-        static void Spawn(Fn&& fn, Args&&... args) {
-            auto fiber = Fiber(fn, std::forward<Args>(args)...);
-            s_JobStack.top().push_back(std::move(fiber));
-        }
-
-        template<typename Fn, typename... Args>
-        static void Spawn(fibers::launch policy, Fn&& fn, Args&&... args) {
-            auto fiber = Fiber(policy, fn, std::forward<Args>(args)...);
-            s_JobStack.top().push_back(std::move(fiber));
-        }
-
-        template<typename Fn, typename... Args>
-        static void Spawn(fibers::fiber_properties* properties, Fn&& fn, Args&&... args) {
-            auto fiber = Fiber(properties, fn, std::forward<Args>(args)...);
-            s_JobStack.top().push_back(std::move(fiber));
-        }
-
-        template<typename Fn, typename... Args>
-        static void Spawn(fibers::launch policy, fibers::fiber_properties* properties, Fn&& fn, Args&&... args) {
-            auto fiber = Fiber(policy, properties, fn, std::forward<Args>(args)...);
-            s_JobStack.top().push_back(std::move(fiber));
+        template<typename Fn>
+        static void Dispatch(JobCounter& counter, usize jobCount, Fn& fn) {
+            Dispatch(counter, [](void* data, usize index) {
+                (*static_cast<Fn*>(data))(index);
+            }, &fn, jobCount);
         }
 
         static uint THREAD_COUNT;
 
     private:
-        using FiberList = std::vector<Fiber>;
+        struct Job {
+            JobFunction Function = nullptr;
+            void* Data = nullptr;
+            usize Index = 0;
+            JobCounter* Counter = nullptr;
+        };
+
+        static constexpr usize JOB_QUEUE_CAPACITY = 4096;
+        static constexpr usize JOB_FIBERS_PER_THREAD = 4;
+        static constexpr usize JOB_STACK_SIZE = 256 * 1024; // Jobs parse YAML and run user code, which can recurse deeply
 
         static boost::thread_group s_Workers;
-        static std::stack<FiberList> s_JobStack;
+        static std::vector<Fiber> s_JobFibers;
+        static JobQueue<Job, JOB_QUEUE_CAPACITY> s_Jobs;
+
+        static void RunJob(const Job& job);
+        static bool RunQueuedJob();
+        static void SpawnJobFibers(std::vector<Fiber>& jobFibers);
+        static void JobFiberRun();
+
+        friend class JobCounter;
 
         Fibers() = delete;
     };
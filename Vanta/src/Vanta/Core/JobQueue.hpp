@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <atomic>
+
+namespace Vanta {
+
+    /// <summary>
+    /// Bounded lock-free multi-producer multi-consumer queue.
+    /// Every cell carries a sequence number telling producers and consumers whose turn it is,
+    /// so pushing and popping only ever contend on a single atomic index.
+    /// </summary>
+    template<typename T, usize Capacity>
+    class JobQueue {
+    public:
+        static_assert((Capacity & (Capacity - 1)) == 0, "JobQueue capacity must be a power of two");
+
+        JobQueue() {
+            for (usize i = 0; i < Capacity; i++)
+                m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        JobQueue(const JobQueue&) = delete;
+        JobQueue& operator=(const JobQueue&) = delete;
+
+        /// <summary>
+        /// Try to add an item to the back of the queue.
+        /// </summary>
+        /// <returns>False if the queue is full.</returns>
+        bool Push(const T& item) {
+            Cell* cell;
+            usize pos = m_PushPos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &m_Cells[pos & (Capacity - 1)];
+                const usize seq = cell->Sequence.load(std::memory_order_acquire);
+                const auto diff = (std::intptr_t)seq - (std::intptr_t)pos;
+
+                if (diff == 0) {
+                    if (m_PushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0) {
+                    return false;
+                }
+                else {
+                    pos = m_PushPos.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->Item = item;
+            cell->Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// <summary>
+        /// Try to take an item from the front of the queue.
+        /// </summary>
+        /// <returns>False if the queue is empty.</returns>
+        bool Pop(T& item) {
+            Cell* cell;
+            usize pos = m_PopPos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &m_Cells[pos & (Capacity - 1)];
+                const usize seq = cell->Sequence.load(std::memory_order_acquire);
+                const auto diff = (std::intptr_t)seq - (std::intptr_t)(pos + 1);
+
+                if (diff == 0) {
+                    if (m_PopPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0) {
+                    return false;
+                }
+                else {
+                    pos = m_PopPos.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = cell->Item;
+            cell->Sequence.store(pos + Capacity, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<usize> Sequence;
+            T Item;
+        };
+
+        std::array<Cell, Capacity> m_Cells;
+        alignas(64) std::atomic<usize> m_PushPos = 0;
+        alignas(64) std::atomic<usize> m_PopPos = 0;
+    };
+}
@@ -1,10 +1,15 @@
 #include "vantapch.hpp"
 #include "Vanta/Core/Window.hpp"
 
+#include "Vanta/Render/GraphicsAPI.hpp"
+
+#include "Platform/Null/Window.hpp"
 #include "Platform/Windows/Window.hpp"
 
 namespace Vanta {
     Box<Window> Window::Create(const WindowParams& params) {
+        if (GraphicsAPI::GetAPI() == GraphicsAPI::None)
+            return NewBox<NullWindow>(params);
         return NewBox<WindowsWindow>(params);
     }
 }
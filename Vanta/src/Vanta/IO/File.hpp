@@ -26,6 +26,31 @@ namespace Vanta {
             bool Exists() const;
         };
 
+        /// <summary>
+        /// Read-only view of a whole file, mapped into memory.
+        /// Pages are read in by the OS as they're touched, so nothing is copied up front.
+        /// </summary>
+        class MappedFile {
+        public:
+            MappedFile(const Path& path);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const uint8* Data() const { return m_Data; }
+            usize Size() const        { return m_Size; }
+
+            operator bool() const { return m_Data != nullptr; }
+
+        private:
+            const uint8* m_Data = nullptr;
+            usize m_Size = 0;
+
+            void* m_File = nullptr;
+            void* m_Mapping = nullptr;
+        };
+
         class FileDialog {
         public:
             static Opt<Path> OpenDirectory();
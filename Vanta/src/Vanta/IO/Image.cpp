@@ -25,5 +25,21 @@ namespace Vanta {
             if (Data)
                 stbi_image_free(Data);
         }
+
+        Image::Image(Image&& other) noexcept
+            : Data(std::exchange(other.Data, nullptr)), Width(other.Width), Height(other.Height), Channels(other.Channels)
+        {}
+
+        Image& Image::operator=(Image&& other) noexcept {
+            if (this != &other) {
+                if (Data)
+                    stbi_image_free(Data);
+                Data = std::exchange(other.Data, nullptr);
+                Width = other.Width;
+                Height = other.Height;
+                Channels = other.Channels;
+            }
+            return *this;
+        }
     }
 }
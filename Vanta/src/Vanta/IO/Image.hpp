@@ -12,6 +12,12 @@ namespace Vanta {
 
             Image(const Path& path);
             ~Image();
+
+            // Owns the decoded pixels, so it can be moved but not copied
+            Image(const Image&) = delete;
+            Image& operator=(const Image&) = delete;
+            Image(Image&& other) noexcept;
+            Image& operator=(Image&& other) noexcept;
         };
     }
 }
@@ -49,7 +49,6 @@ namespace Vanta {
             return GetRootDirectory();
         }
 
-        /// TODO: Move to an asset manager
         static Path GetAssetPath(const Path& filepath) {
             VANTA_CORE_ASSERT(s_ActiveProject, "No project currently loaded!");
             return GetAssetDirectory() / filepath;
@@ -3,11 +3,13 @@
 #include "Vanta/Render/Buffer.hpp"
 
 #include "Platform/OpenGL/Buffer.hpp"
+#include "Platform/Null/Buffer.hpp"
 
 namespace Vanta {
 
     Ref<VertexBuffer> VertexBuffer::Create(usize size) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullVertexBuffer>();
         case GraphicsAPI::OpenGL: return NewBox<OpenGLVertexBuffer>(size);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -17,6 +19,7 @@ namespace Vanta {
 
     Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint count) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullVertexBuffer>();
         case GraphicsAPI::OpenGL: return NewBox<OpenGLVertexBuffer>(vertices, count);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -24,8 +27,19 @@ namespace Vanta {
         }
     }
 
+    Ref<StreamingVertexBuffer> StreamingVertexBuffer::Create(usize regionSize, uint regionCount) {
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullStreamingVertexBuffer>(regionSize, regionCount);
+        case GraphicsAPI::OpenGL: return NewBox<OpenGLStreamingVertexBuffer>(regionSize, regionCount);
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+    }
+
     Ref<IndexBuffer> IndexBuffer::Create(uint* indices, uint count) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullIndexBuffer>(count);
         case GraphicsAPI::OpenGL: return NewBox<OpenGLIndexBuffer>(indices, count);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -33,8 +47,65 @@ namespace Vanta {
         }
     }
 
-    BufferLayout::BufferLayout(const std::initializer_list<Element>& elements)
-        : m_Elements(elements), m_Stride(0)
+    Ref<IndirectBuffer> IndirectBuffer::Create(uint capacity) {
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullIndirectBuffer>(capacity);
+        case GraphicsAPI::OpenGL: return NewBox<OpenGLIndirectBuffer>(capacity);
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+    }
+
+    void StreamingVertexBuffer::SetData(const void*, usize) {
+        VANTA_UNREACHABLE("Streaming vertex buffers are written with Map and Commit!");
+    }
+
+    void* StreamingVertexBuffer::Map(usize size) {
+        // Keep data aligned to whole vertices, so draws can be offset by vertex
+        const usize stride = std::max<usize>(m_Layout.GetStride(), 1);
+        auto align = [stride](usize offset) { return (offset + stride - 1) / stride * stride; };
+
+        usize head = align(m_Head);
+        if (head + size > (m_Region + 1) * m_RegionSize) {
+            // Out of room, move on to the next region once the GPU is done with it
+            NextFrame();
+            head = align(m_Head);
+
+            VANTA_CORE_ASSERT(head + size <= (m_Region + 1) * m_RegionSize, "Streaming vertex buffer region too small!");
+        }
+
+        m_Head = head;
+        m_MappedSize = (m_Region + 1) * m_RegionSize - head;
+        return m_Memory + m_Head;
+    }
+
+    void StreamingVertexBuffer::NextFrame() {
+        FenceRegion(m_Region);
+        m_Region = (m_Region + 1) % m_RegionCount;
+        WaitForRegion(m_Region);
+        m_Head = m_Region * m_RegionSize;
+        m_MappedSize = 0;
+    }
+
+    bool StreamingVertexBuffer::Fits(usize size) const {
+        const usize stride = std::max<usize>(m_Layout.GetStride(), 1);
+        const usize head = (m_Head + stride - 1) / stride * stride;
+        return head + size <= (m_Region + 1) * m_RegionSize;
+    }
+
+    uint StreamingVertexBuffer::Commit(usize size) {
+        VANTA_CORE_ASSERT(size <= m_MappedSize, "Committed more than was mapped!");
+
+        const usize stride = std::max<usize>(m_Layout.GetStride(), 1);
+        const usize offset = m_Head;
+        m_Head += size;
+        m_MappedSize = 0;
+        return (uint)(offset / stride);
+    }
+
+    BufferLayout::BufferLayout(const std::initializer_list<Element>& elements, StepRate stepRate)
+        : m_Elements(elements), m_Stride(0), m_StepRate(stepRate)
     {
         CalcOffsetAndStride();
     }
@@ -5,6 +5,14 @@ namespace Vanta {
 
     class BufferLayout {
     public:
+        /// <summary>
+        /// How often the shader advances to the next element of a buffer.
+        /// </summary>
+        enum class StepRate {
+            PerVertex = 0,
+            PerInstance = 1,
+        };
+
         struct Element {
             std::string Name;
             Shader::DataType Type;
@@ -16,14 +24,16 @@ namespace Vanta {
         };
 
         BufferLayout() = default;
-        BufferLayout(const std::initializer_list<Element>& elements);
+        BufferLayout(const std::initializer_list<Element>& elements, StepRate stepRate = StepRate::PerVertex);
 
         const std::vector<Element>& GetElements() const { return m_Elements; }
         usize GetStride() const { return m_Stride; }
+        StepRate GetStepRate() const { return m_StepRate; }
 
     private:
         std::vector<Element> m_Elements;
         usize m_Stride = 0;
+        StepRate m_StepRate = StepRate::PerVertex;
 
         void CalcOffsetAndStride();
     };
@@ -40,6 +50,8 @@ namespace Vanta {
 
         virtual void SetData(const void* data, usize size) = 0;
 
+        virtual uint32 GetRendererID() const = 0;
+
         static Ref<VertexBuffer> Create(usize size);
         static Ref<VertexBuffer> Create(float* vertices, uint count);
 
@@ -47,6 +59,89 @@ namespace Vanta {
         VertexBuffer() = default;
     };
 
+    /// <summary>
+    /// Vertex buffer for data that is rewritten every frame, written straight into mapped memory.
+    /// The buffer is split into a ring of regions, each meant to hold a whole frame. Data is appended
+    /// to the current region, and at the end of the frame the region is fenced and writing moves on
+    /// to the next one, waiting for the GPU to be done reading it first. A frame that outgrows its
+    /// region moves on early the same way. Nothing the GPU may still be reading is ever written over.
+    ///
+    /// Since data lands at different offsets, draws must start at the offset returned by `Commit`.
+    /// </summary>
+    class StreamingVertexBuffer : public VertexBuffer {
+    public:
+        static constexpr uint DEFAULT_REGION_COUNT = 3;
+
+        virtual ~StreamingVertexBuffer() = default;
+
+        const BufferLayout& GetLayout() const override      { return m_Layout; }
+        void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+        /// <summary>
+        /// Streaming buffers are only written through `Map` and `Commit`.
+        /// </summary>
+        void SetData(const void* data, usize size) override;
+
+        /// <summary>
+        /// Get memory for writing at least `size` bytes of vertices, at most one region.
+        /// Everything left in the region is mapped; `GetMappedSize` tells how much that is.
+        /// The memory stays valid until the next call to `Map`.
+        /// </summary>
+        void* Map(usize size);
+
+        /// <summary>
+        /// Number of bytes that can be written to the last mapped memory.
+        /// </summary>
+        usize GetMappedSize() const { return m_MappedSize; }
+
+        /// <summary>
+        /// Whether `size` bytes can be mapped without moving on to the next region.
+        /// Draws reading the current region must be submitted before it's left.
+        /// </summary>
+        bool Fits(usize size) const;
+
+        /// <summary>
+        /// Finish writing the first `size` bytes of the last mapped memory.
+        /// </summary>
+        /// <returns>Offset of the written data in the buffer, in vertices.</returns>
+        uint Commit(usize size);
+
+        /// <summary>
+        /// Fence the current region and move on to the next one, once the frame's draws have been submitted.
+        /// </summary>
+        void NextFrame();
+
+        usize GetRegionSize() const { return m_RegionSize; }
+        uint GetRegionCount() const { return m_RegionCount; }
+        uint GetRegion() const      { return m_Region; }
+
+        static Ref<StreamingVertexBuffer> Create(usize regionSize, uint regionCount = DEFAULT_REGION_COUNT);
+
+    protected:
+        uint8* m_Memory = nullptr; // Mapped memory of all regions, set by the backend
+
+        StreamingVertexBuffer(usize regionSize, uint regionCount)
+            : m_RegionSize(regionSize), m_RegionCount(regionCount) {}
+
+        /// <summary>
+        /// Mark a region as done being written, once all draws reading it have been submitted.
+        /// </summary>
+        virtual void FenceRegion(uint region) = 0;
+
+        /// <summary>
+        /// Wait for the GPU to be done reading a region.
+        /// </summary>
+        virtual void WaitForRegion(uint region) = 0;
+
+    private:
+        BufferLayout m_Layout;
+        usize m_RegionSize = 0;
+        uint m_RegionCount = 0;
+        uint m_Region = 0;
+        usize m_Head = 0;       // Offset of the mapped memory
+        usize m_MappedSize = 0;
+    };
+
     class IndexBuffer {
     public:
         virtual ~IndexBuffer() = default;
@@ -61,4 +156,40 @@ namespace Vanta {
     protected:
         IndexBuffer() = default;
     };
-}
\ No newline at end of file
+
+    /// <summary>
+    /// Parameters of one indexed draw, laid out as the GPU reads them from an indirect buffer.
+    /// </summary>
+    struct DrawIndexedIndirectCommand {
+        uint32 IndexCount = 0;
+        uint32 InstanceCount = 0;
+        uint32 FirstIndex = 0;
+        int32 BaseVertex = 0;
+        uint32 BaseInstance = 0;
+    };
+
+    /// <summary>
+    /// Draw commands recorded on the CPU and issued together with a single multi-draw.
+    /// Commands are written straight into mapped memory, so callers must not write over
+    /// commands the GPU may still be reading.
+    /// </summary>
+    class IndirectBuffer {
+    public:
+        virtual ~IndirectBuffer() = default;
+
+        virtual void Bind() const = 0;
+        virtual void Unbind() const = 0;
+
+        /// <summary>
+        /// Write commands to the buffer, starting at command `first`. At most `GetCapacity` commands fit.
+        /// </summary>
+        virtual void SetData(const DrawIndexedIndirectCommand* commands, uint count, uint first = 0) = 0;
+
+        virtual uint GetCapacity() const = 0;
+
+        static Ref<IndirectBuffer> Create(uint capacity);
+
+    protected:
+        IndirectBuffer() = default;
+    };
+}
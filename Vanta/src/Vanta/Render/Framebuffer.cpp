@@ -3,11 +3,13 @@
 #include "Vanta/Render/GraphicsAPI.hpp"
 
 #include "Platform/OpenGL/Framebuffer.hpp"
+#include "Platform/Null/Framebuffer.hpp"
 
 namespace Vanta {
 
     Ref<Framebuffer> Framebuffer::Create(const FramebufferParams& params) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullFramebuffer>(params);
         case GraphicsAPI::OpenGL: return NewBox<OpenGLFramebuffer>(params);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -42,6 +42,17 @@ namespace Vanta {
         bool SwapChainTarget = false;
     };
 
+    /// <summary>
+    /// Rectangle of pixels read back from an integer attachment.
+    /// </summary>
+    struct FramebufferReadback {
+        int X = 0, Y = 0;
+        uint32 Width = 0, Height = 0;
+        std::vector<int> Pixels; // Row by row, starting from the bottom
+
+        int Get(uint32 x, uint32 y) const { return Pixels[y * Width + x]; }
+    };
+
     class Framebuffer {
     public:
         virtual ~Framebuffer() = default;
@@ -50,8 +61,26 @@ namespace Vanta {
         virtual void Unbind() const = 0;
 
         virtual void Resize(uint32 width, uint32 height) = 0;
+
+        /// <summary>
+        /// Read a single pixel of an integer attachment.
+        /// Waits for everything drawn so far to finish, prefer `RequestPixels` every frame.
+        /// </summary>
         virtual int ReadPixel(uint32 attachmentIndex, int x, int y) = 0;
 
+        /// <summary>
+        /// Start reading a rectangle of an integer attachment, without waiting for drawing to finish.
+        /// The result arrives through `PollPixels` a frame or two later.
+        /// Returns false if too many reads are still in flight, in which case the request is dropped.
+        /// </summary>
+        virtual bool RequestPixels(uint32 attachmentIndex, int x, int y, uint32 width, uint32 height) = 0;
+
+        /// <summary>
+        /// Get the latest requested read that has finished, if one has finished since the last poll.
+        /// Reads requested before it are discarded.
+        /// </summary>
+        virtual bool PollPixels(FramebufferReadback& readback) = 0;
+
         virtual void ClearAttachment(uint32 attachmentIndex, int value) = 0;
 
         virtual uint32 GetColorAttachmentRendererID(uint32 attachmentIndex = 0) const = 0;
@@ -0,0 +1,32 @@
+#include "vantapch.hpp"
+#include "Vanta/Render/Frustum.hpp"
+
+namespace Vanta {
+
+    BoundingBox BoundingBox::FromQuad(const glm::mat4& transform) {
+        // The quad's corners are its center, plus or minus half of each transformed axis
+        const glm::vec3 x = glm::abs(glm::vec3(transform[0])) * 0.5f;
+        const glm::vec3 y = glm::abs(glm::vec3(transform[1])) * 0.5f;
+        return { glm::vec3(transform[3]), x + y };
+    }
+
+    Frustum::Frustum(const glm::mat4& viewProjection) {
+        // Planes are sums and differences of the matrix's rows (Gribb & Hartmann)
+        const glm::mat4 m = glm::transpose(viewProjection);
+        const glm::vec4 planes[6] = {
+            m[3] + m[0], // Left
+            m[3] - m[0], // Right
+            m[3] + m[1], // Bottom
+            m[3] - m[1], // Top
+            m[3] + m[2], // Near
+            m[3] - m[2], // Far
+        };
+
+        for (usize i = 0; i < 6; i++) {
+            m_X[i] = planes[i].x;
+            m_Y[i] = planes[i].y;
+            m_Z[i] = planes[i].z;
+            m_W[i] = planes[i].w;
+        }
+    }
+}
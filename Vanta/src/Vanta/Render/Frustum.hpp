@@ -0,0 +1,51 @@
+#pragma once
+
+namespace Vanta {
+
+    /// <summary>
+    /// Axis aligned bounding box, stored as its center and half size.
+    /// </summary>
+    struct BoundingBox {
+        glm::vec3 Center;
+        glm::vec3 Extents;
+
+        /// <summary>
+        /// World bounds of a unit quad, centered on the origin, after a transform.
+        /// </summary>
+        static BoundingBox FromQuad(const glm::mat4& transform);
+    };
+
+    /// <summary>
+    /// View frustum, made of the six clip planes of a view projection matrix.
+    /// Planes are stored component by component, padded to eight,
+    /// so testing a box against all of them vectorizes.
+    /// </summary>
+    class Frustum {
+    public:
+        Frustum() = default;
+        explicit Frustum(const glm::mat4& viewProjection);
+
+        /// <summary>
+        /// Whether any part of a box may be inside the frustum.
+        /// Boxes near corners may be let through, but none inside are ever rejected.
+        /// </summary>
+        bool Intersects(const BoundingBox& box) const {
+            // Distance of the box's nearest corner to every plane; a corner in front of all planes is visible
+            bool outside = false;
+            for (usize i = 0; i < PLANE_COUNT; i++) {
+                const float distance = m_X[i] * box.Center.x + m_Y[i] * box.Center.y + m_Z[i] * box.Center.z + m_W[i];
+                const float radius = std::abs(m_X[i]) * box.Extents.x + std::abs(m_Y[i]) * box.Extents.y + std::abs(m_Z[i]) * box.Extents.z;
+                outside |= (distance + radius < 0.f);
+            }
+            return !outside;
+        }
+
+    private:
+        static constexpr usize PLANE_COUNT = 8; // Six planes, padded with ones that reject nothing
+
+        alignas(32) float m_X[PLANE_COUNT] = {};
+        alignas(32) float m_Y[PLANE_COUNT] = {};
+        alignas(32) float m_Z[PLANE_COUNT] = {};
+        alignas(32) float m_W[PLANE_COUNT] = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+    };
+}
@@ -2,6 +2,7 @@
 #include "Vanta/Render/GraphicsAPI.hpp"
 
 #include "Platform/OpenGL/GraphicsAPI.hpp"
+#include "Platform/Null/GraphicsAPI.hpp"
 
 namespace Vanta {
     
@@ -9,6 +10,7 @@ namespace Vanta {
 
     Box<GraphicsAPI> GraphicsAPI::Create() {
         switch (s_API) {
+        case API::None:   return NewBox<NullGraphicsAPI>();
         case API::OpenGL: return NewBox<OpenGLGraphicsAPI>();
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -1,4 +1,5 @@
 #pragma once 
+#include "Vanta/Render/Buffer.hpp"
 #include "Vanta/Render/VertexArray.hpp"
 
 namespace Vanta {
@@ -18,8 +19,10 @@ namespace Vanta {
         virtual void SetClearColor(const glm::vec4& color = glm::vec4(0.2f, 0.2f, 0.2f, 1.f)) = 0;
         virtual void Clear() = 0;
 
-        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount) = 0;
-        virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount) = 0;
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount, uint baseVertex) = 0;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint baseInstance) = 0;
+        virtual void MultiDrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand) = 0;
+        virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount, uint firstVertex) = 0;
 
         virtual void SetLineWidth(float width) = 0;
 
@@ -3,5 +3,5 @@
 
 namespace Vanta {
 
-    Box<GraphicsAPI> RenderCommand::s_GraphicsAPI = GraphicsAPI::Create();
+    Box<GraphicsAPI> RenderCommand::s_GraphicsAPI;
 }
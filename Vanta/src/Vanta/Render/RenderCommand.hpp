@@ -6,9 +6,12 @@ namespace Vanta {
     class RenderCommand {
     public:
         static void Init() {
+            s_GraphicsAPI = GraphicsAPI::Create();
             s_GraphicsAPI->Init();
         }
 
+        static GraphicsAPI& GetGraphicsAPI() { return *s_GraphicsAPI; }
+
         static void SetViewport(uint x, uint y, uint width, uint height) {
             s_GraphicsAPI->SetViewport(x, y, width, height);
         }
@@ -21,12 +24,20 @@ namespace Vanta {
             s_GraphicsAPI->Clear();
         }
 
-        static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount = 0) {
-            s_GraphicsAPI->DrawIndexed(vertexArray, indexCount);
+        static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint indexCount = 0, uint baseVertex = 0) {
+            s_GraphicsAPI->DrawIndexed(vertexArray, indexCount, baseVertex);
+        }
+
+        static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint indexCount, uint instanceCount, uint baseInstance = 0) {
+            s_GraphicsAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount, baseInstance);
+        }
+
+        static void MultiDrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& commands, uint drawCount, uint firstCommand = 0) {
+            s_GraphicsAPI->MultiDrawIndexedIndirect(vertexArray, commands, drawCount, firstCommand);
         }
 
-        static void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount) {
-            s_GraphicsAPI->DrawLines(vertexArray, vertexCount);
+        static void DrawLines(const Ref<VertexArray>& vertexArray, uint vertexCount, uint firstVertex = 0) {
+            s_GraphicsAPI->DrawLines(vertexArray, vertexCount, firstVertex);
         }
 
         static void SetLineWidth(float width) {
@@ -0,0 +1,111 @@
+#include "vantapch.hpp"
+#include "Vanta/Render/RenderQueue.hpp"
+
+namespace Vanta {
+
+    // Map a float to an unsigned integer that sorts in the same order
+    static uint32 SortableFloat(float value) {
+        uint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+    }
+
+    uint64 RenderQueue::MakeKey(Layer layer, float depth, uint32 shader, uint32 texture) {
+        VANTA_CORE_ASSERT(shader < (1u << SHADER_BITS), "Shader doesn't fit in sort key!");
+
+        const uint64 material = ((uint64)shader << TEXTURE_BITS) | (texture & ((1u << TEXTURE_BITS) - 1));
+        const uint64 sortDepth = SortableFloat(depth);
+
+        switch (layer) {
+        case Layer::Opaque:
+            return (material << 32) | sortDepth;
+        case Layer::Translucent:
+            return (1ull << 63) | ((0xffffffffull - sortDepth) << (SHADER_BITS + TEXTURE_BITS)) | material;
+        default:
+            VANTA_UNREACHABLE("Invalid render layer!");
+            return 0;
+        }
+    }
+
+    RenderQueue::Item* RenderQueue::Append(usize count) {
+        const usize first = m_Items.size();
+        m_Items.resize(first + count);
+        return m_Items.data() + first;
+    }
+
+    void RenderQueue::Sort() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        const usize count = m_Items.size();
+        if (count <= 1)
+            return;
+
+        // Only sort by the bytes that differ between keys
+        uint64 varying = 0;
+        for (const Item& item : m_Items)
+            varying |= item.Key ^ m_Items[0].Key;
+        if (varying == 0)
+            return;
+
+        const usize workers = std::max<usize>(Fibers::THREAD_COUNT, 1);
+        const usize jobCount = std::clamp<usize>(count / SORT_MIN_PER_JOB, 1, workers);
+
+        m_Scratch.resize(count);
+        m_Counts.resize(jobCount);
+
+        auto run = [jobCount](auto&& fn) {
+            if (jobCount == 1) {
+                fn(0);
+                return;
+            }
+
+            JobCounter counter;
+            Fibers::Dispatch(counter, jobCount, fn);
+            counter.Wait();
+        };
+
+        // Every job counts and scatters its own contiguous range, so the sort stays stable
+        Item* src = m_Items.data();
+        Item* dst = m_Scratch.data();
+
+        for (uint pass = 0; pass < RADIX_PASSES; pass++) {
+            const uint shift = pass * RADIX_BITS;
+            if (((varying >> shift) & (RADIX_SIZE - 1)) == 0)
+                continue;
+
+            run([&](usize job) {
+                auto& counts = m_Counts[job];
+                counts.fill(0);
+
+                const usize begin = count * job / jobCount;
+                const usize end = count * (job + 1) / jobCount;
+                for (usize i = begin; i < end; i++)
+                    counts[(src[i].Key >> shift) & (RADIX_SIZE - 1)]++;
+            });
+
+            // Turn counts into where every job writes its first item of each digit
+            usize offset = 0;
+            for (uint digit = 0; digit < RADIX_SIZE; digit++) {
+                for (usize job = 0; job < jobCount; job++) {
+                    const usize digitCount = m_Counts[job][digit];
+                    m_Counts[job][digit] = offset;
+                    offset += digitCount;
+                }
+            }
+
+            run([&](usize job) {
+                auto& offsets = m_Counts[job];
+
+                const usize begin = count * job / jobCount;
+                const usize end = count * (job + 1) / jobCount;
+                for (usize i = begin; i < end; i++)
+                    dst[offsets[(src[i].Key >> shift) & (RADIX_SIZE - 1)]++] = src[i];
+            });
+
+            std::swap(src, dst);
+        }
+
+        if (src != m_Items.data())
+            m_Items.swap(m_Scratch);
+    }
+}
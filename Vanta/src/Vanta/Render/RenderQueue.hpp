@@ -0,0 +1,71 @@
+#pragma once
+
+namespace Vanta {
+
+    /// <summary>
+    /// List of draws ordered by 64-bit sort keys.
+    /// Every draw carries a key, built with `MakeKey`, and a payload the caller uses to find
+    /// what to draw. Sorting orders draws by layer first; opaque draws are grouped by shader and
+    /// texture to keep state changes down, and translucent draws are ordered back to front so
+    /// they blend correctly.
+    ///
+    /// Keys are radix sorted, split over the fiber pool when there are enough of them.
+    /// The sort is stable, so draws with equal keys keep the order they were pushed in.
+    /// </summary>
+    class RenderQueue {
+    public:
+        enum class Layer : uint8 {
+            Opaque = 0,
+            Translucent = 1,
+        };
+
+        struct Item {
+            uint64 Key;
+            uint64 Payload;
+        };
+
+        static constexpr uint SHADER_BITS = 4;
+        static constexpr uint TEXTURE_BITS = 27;
+
+        /// Fewest draws worth handing to a fiber when sorting.
+        static constexpr usize SORT_MIN_PER_JOB = 4096;
+
+        /// <summary>
+        /// Build a sort key.
+        /// Opaque:      [layer:1][shader:4][texture:27][depth, front to back:32]
+        /// Translucent: [layer:1][depth, back to front:32][shader:4][texture:27]
+        /// </summary>
+        /// <param name="depth">Normalized device depth, smaller is nearer.</param>
+        static uint64 MakeKey(Layer layer, float depth, uint32 shader, uint32 texture);
+        static Layer GetLayer(uint64 key) { return (Layer)(key >> 63); }
+
+        void Clear() { m_Items.clear(); }
+        void Reserve(usize count) { m_Items.reserve(count); }
+
+        void Push(uint64 key, uint64 payload) { m_Items.push_back({ key, payload }); }
+
+        /// <summary>
+        /// Make room for `count` more draws and get them, so they can be filled in from many threads.
+        /// </summary>
+        Item* Append(usize count);
+
+        void Sort();
+
+        usize Size() const   { return m_Items.size(); }
+        bool IsEmpty() const { return m_Items.empty(); }
+
+        const Item& operator[](usize index) const { return m_Items[index]; }
+
+        std::vector<Item>::const_iterator begin() const { return m_Items.begin(); }
+        std::vector<Item>::const_iterator end() const   { return m_Items.end(); }
+
+    private:
+        static constexpr uint RADIX_BITS = 8;
+        static constexpr uint RADIX_SIZE = 1 << RADIX_BITS;
+        static constexpr uint RADIX_PASSES = 64 / RADIX_BITS;
+
+        std::vector<Item> m_Items;
+        std::vector<Item> m_Scratch;
+        std::vector<std::array<usize, RADIX_SIZE>> m_Counts; // Per job and digit, then turned into offsets
+    };
+}
@@ -15,6 +15,11 @@ namespace Vanta {
         Renderer2D::Shutdown();
     }
 
+    void Renderer::FrameEnd() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        Renderer2D::FrameEnd();
+    }
+
     ShaderLibrary& Renderer::GetShaderLibrary() {
         static ShaderLibrary instance;
         return instance;
@@ -10,6 +10,11 @@ namespace Vanta {
         static void Init();
         static void Shutdown();
 
+        /// <summary>
+        /// Finish drawing the frame, before the window swaps buffers.
+        /// </summary>
+        static void FrameEnd();
+
         static ShaderLibrary& GetShaderLibrary();
 
         static GraphicsAPI::API GetAPI() { return GraphicsAPI::GetAPI(); }
@@ -1,7 +1,10 @@
 #include "vantapch.hpp"
 #include "Vanta/Core/Engine.hpp"
 #include "Vanta/Render/RenderCommand.hpp"
+#include "Vanta/Render/RenderQueue.hpp"
 #include "Vanta/Render/Renderer2D.hpp"
+#include "Vanta/Render/StorageBuffer.hpp"
+#include "Vanta/Render/TextureArrayCache.hpp"
 #include "Vanta/Render/UniformBuffer.hpp"
 #include "Vanta/Render/VertexArray.hpp"
 #include "Vanta/Scene/Components.hpp"
@@ -16,70 +19,105 @@ namespace Vanta {
             {  0.5f,  0.5f, 0.0f, 1.0f },
             { -0.5f,  0.5f, 0.0f, 1.0f },
         };
-        static constexpr glm::vec2 TEX_COORDS[] = {
-            { 0.0f, 0.0f },
-            { 1.0f, 0.0f },
-            { 1.0f, 1.0f },
-            { 0.0f, 1.0f },
-        };
     };
 
-    struct QuadVertex {
-        glm::vec3 Position;
-        glm::vec4 Color;
-        glm::vec2 TexCoords;
-        float TilingFactor;
-        int TexID;
+    // Entity IDs are always the last attribute, so leaving them out doesn't move any other
+    static BufferLayout QuadInstanceLayout() {
+        return BufferLayout({
+            { Shader::DataType::Float3,   "aAxisX" },
+            { Shader::DataType::Float3,   "aAxisY" },
+            { Shader::DataType::Float3,   "aTranslation" },
+            { Shader::DataType::UNorm4x8, "aColor" },
+            { Shader::DataType::Float,    "aTilingFactor" },
+            { Shader::DataType::Int,      "aTexID" },
+#ifdef VANTA_RENDER_ENTITY_ID
+            { Shader::DataType::Int,      "aEntityID" },
+#endif
+        }, BufferLayout::StepRate::PerInstance);
+    }
 
-        // Editor data
-        int EntityID = -1;
+    // Quads are flat in their own space, so the transformed X and Y axes are all the shader needs.
+    // Both keep their Z, so quads tilted out of the XY plane still get depth and perspective.
+    QuadInstance::QuadInstance(const glm::mat4& transform, const glm::vec4& color, float tilingFactor, [[maybe_unused]] int entityID)
+        : AxisX(transform[0]),
+          AxisY(transform[1]),
+          Translation(transform[3]),
+          Color(glm::packUnorm4x8(color)),
+          TilingFactor(tilingFactor),
+          TexID(0)
+    {
+#ifdef VANTA_RENDER_ENTITY_ID
+        EntityID = entityID;
+#endif
+    }
 
-        static BufferLayout Layout() {
-            return {
-                { Shader::DataType::Float3, "aPosition" },
-                { Shader::DataType::Float4, "aColor" },
-                { Shader::DataType::Float2, "aTexCoords" },
-                { Shader::DataType::Float,  "aTilingFactor" },
-                { Shader::DataType::Int,    "aTexID" },
-                { Shader::DataType::Int,    "aEntityID" },
-            };
-        }
-    };
+    void QuadList::Clear() {
+        m_Instances.clear();
+        m_Textures.clear();
+    }
+
+    void QuadList::Reserve(usize count) {
+        m_Instances.reserve(count);
+        m_Textures.reserve(count);
+    }
+
+    void QuadList::Add(const glm::mat4& transform, const glm::vec4& color, int entityID) {
+        m_Instances.emplace_back(transform, color, 1.f, entityID);
+        m_Textures.push_back(nullptr);
+    }
+
+    void QuadList::Add(const glm::mat4& transform, const Ref<Texture2D>& tex, float tilingFactor, const glm::vec4& tint, int entityID) {
+        m_Instances.emplace_back(transform, tint, tilingFactor, entityID);
+        m_Textures.push_back(tex ? &tex : nullptr);
+    }
+
+    void QuadList::AddSprite(const glm::mat4& transform, const SpriteComponent& sprite, int entityID) {
+        if (sprite.Texture)
+            Add(transform, sprite.Texture, sprite.TilingFactor, sprite.Color, entityID);
+        else
+            Add(transform, sprite.Color, entityID);
+    }
 
     struct CircleVertex {
         glm::vec3 WorldPosition;
-        glm::vec3 LocalPosition;
-        glm::vec4 Color;
-        float Thickness;
-        float Fade;
+        uint32 LocalPosition;   // Half floats, corners are at +-1
+        uint32 Color;           // RGBA8
+        uint32 ThicknessFade;   // Unorm16 each
 
+#ifdef VANTA_RENDER_ENTITY_ID
         // Editor data
         int EntityID = -1;
+#endif
 
         static BufferLayout Layout() {
             return {
-                { Shader::DataType::Float3, "aWorldPosition" },
-                { Shader::DataType::Float3, "aLocalPosition" },
-                { Shader::DataType::Float4, "aColor" },
-                { Shader::DataType::Float,  "aThickness" },
-                { Shader::DataType::Float,  "aFade" },
-                { Shader::DataType::Int,    "aEntityID" },
+                { Shader::DataType::Float3,    "aWorldPosition" },
+                { Shader::DataType::Half2x16,  "aLocalPosition" },
+                { Shader::DataType::UNorm4x8,  "aColor" },
+                { Shader::DataType::UNorm2x16, "aThicknessFade" },
+#ifdef VANTA_RENDER_ENTITY_ID
+                { Shader::DataType::Int,       "aEntityID" },
+#endif
             };
         }
     };
 
     struct LineVertex {
         glm::vec3 Position;
-        glm::vec4 Color;
+        uint32 Color;           // RGBA8
 
+#ifdef VANTA_RENDER_ENTITY_ID
         // Editor data
         int EntityID = -1;
+#endif
 
         static BufferLayout Layout() {
             return {
-                { Shader::DataType::Float3, "aPosition" },
-                { Shader::DataType::Float4, "aColor" },
-                { Shader::DataType::Int,    "aEntityID" },
+                { Shader::DataType::Float3,   "aPosition" },
+                { Shader::DataType::UNorm4x8, "aColor" },
+#ifdef VANTA_RENDER_ENTITY_ID
+                { Shader::DataType::Int,      "aEntityID" },
+#endif
             };
         }
     };
@@ -88,37 +126,98 @@ namespace Vanta {
         static constexpr uint MaxQuads = 0x1fff;
         static constexpr uint MaxVerts = MaxQuads * 4;
         static constexpr uint MaxIndices = MaxQuads * 6;
+        static constexpr uint QuadIndices = 6;
         static constexpr uint MaxTextureSlots = 16;
 
+        // Streaming regions hold a whole frame of full batches, so the GPU is only waited on between frames
+        static constexpr uint QuadBatchesPerFrame = 8;
+        static constexpr uint ShapeBatchesPerFrame = 4;
+
         // Render objects
         Ref<VertexArray> QuadVAO;
-        Ref<VertexBuffer> QuadVBO;
+        Ref<StreamingVertexBuffer> QuadVBO;
+        Ref<IndexBuffer> QuadIBO;   // Shared with baked batches
         Ref<Shader> QuadShader;
 
         Ref<VertexArray> CircleVAO;
-        Ref<VertexBuffer> CircleVBO;
+        Ref<StreamingVertexBuffer> CircleVBO;
         Ref<Shader> CircleShader;
 
         Ref<VertexArray> LineVAO;
-        Ref<VertexBuffer> LineVBO;
+        Ref<StreamingVertexBuffer> LineVBO;
         Ref<Shader> LineShader;
 
-        // Vertex buffers
-        QuadVertex* QuadVertexBuffer = nullptr;
-        QuadVertex* QuadVertexBufferPtr = nullptr;
-        uint QuadIndexCount = 0;
+        // Instance and vertex data of the current batch, mapped from the streaming buffers.
+        // A batch ends when it's full or when the space left in the region runs out, whichever is first.
+        QuadInstance* QuadInstanceBuffer = nullptr;
+        QuadInstance* QuadInstanceBufferPtr = nullptr;
+        uint QuadInstanceCount = 0;
+        uint QuadInstanceCapacity = 0;
 
         CircleVertex* CircleVertexBuffer = nullptr;
         CircleVertex* CircleVertexBufferPtr = nullptr;
         uint CircleIndexCount = 0;
+        uint CircleVertexCapacity = 0;
 
         LineVertex* LineVertexBuffer = nullptr;
         LineVertex* LineVertexBufferPtr = nullptr;
         uint LineVertexCount = 0;
+        uint LineVertexCapacity = 0;
 
         // Textures
-        std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
-        uint TextureSlotIdx = 1; // 0 = white texture
+        // Textures are copied into texture array pages, and every slot holds a whole page.
+        // TexID packs the slot into the low 8 bits and the layer into the rest.
+        static constexpr uint TexSlotBits = 8;
+        static constexpr uint TexSlotMask = (1 << TexSlotBits) - 1;
+
+        struct PageSlot {
+            usize BatchIndex = 0; // Batch the page was last bound in
+            uint Slot = 0;
+        };
+
+        TextureArrayCache TextureArrays;
+        std::vector<PageSlot> PageSlots;                    // Indexed by page
+        std::array<uint32, MaxTextureSlots> TextureSlots;   // Page bound to each slot
+        uint TextureSlotIdx = 1; // 0 = white texture page
+        usize BatchIndex = 0;    // Incremented on every new batch, when texture slots are reset
+
+        Ref<Texture2D> WhiteTexture;
+        TextureLocation WhiteTextureLocation;
+
+        // Indirect submission
+        // Recorded batches share one set of texture units. Each batch maps its own slots onto them
+        // through its entry in the batch state buffer, which the shader looks up by draw ID.
+        // Batches are only submitted early when their pages don't fit the shared units.
+        static constexpr uint MaxTextureUnits = 32;
+        static constexpr uint InitialIndirectBatches = 256; // Per frame, grows when a frame records more
+
+        struct BatchState {
+            uint32 Units[MaxTextureSlots]; // Texture unit of each slot
+        };
+
+        // State ranges are bound by offset, which has to be aligned
+        static constexpr uint BatchStateAlignment = StorageBuffer::RANGE_ALIGNMENT / sizeof(BatchState);
+
+        Renderer2D::Submission SubmitMode = Renderer2D::Submission::Immediate;
+        Ref<IndirectBuffer> QuadCommandBuffer;
+        Ref<StorageBuffer> BatchStateBuffer;
+        Ref<StorageBuffer> IdentityBatchState; // Bound for direct draws, where every slot is its own unit
+        std::vector<DrawIndexedIndirectCommand> QuadCommands;
+        std::vector<BatchState> BatchStates;
+        std::array<uint32, MaxTextureUnits> UnitPages; // Page bound to each unit
+        uint UnitCount = 0;
+
+        // Commands and batch states are written to a ring of per-frame regions, one per streaming vertex region.
+        // A region is written again only after the quad streaming buffer has waited out the frame that used it.
+        uint IndirectFrameCapacity = 0; // Batches per region
+        uint IndirectFrameCount = 0;
+        uint IndirectFrame = 0;
+        uint IndirectHead = 0;          // Batches written to the current region
+
+        // Neighbouring quads mostly share a texture, so the last lookup is remembered
+        const Texture2D* LastTexture = nullptr;
+        usize LastTextureBatch = 0;
+        uint LastTexID = 0;
 
         // Uniforms
         struct CameraData {
@@ -135,6 +234,16 @@ namespace Vanta {
 
     static RenderData s_Data;
 
+    // Buffers in use by draws still in flight are only released once the GPU is done with them
+    static void CreateIndirectBuffers(uint capacity) {
+        capacity = (capacity + RenderData::BatchStateAlignment - 1) / RenderData::BatchStateAlignment * RenderData::BatchStateAlignment;
+
+        s_Data.IndirectFrameCapacity = capacity;
+        s_Data.QuadCommandBuffer = IndirectBuffer::Create(capacity * s_Data.IndirectFrameCount);
+        s_Data.BatchStateBuffer = StorageBuffer::Create(sizeof(RenderData::BatchState) * capacity * s_Data.IndirectFrameCount, 1);
+        s_Data.IndirectHead = 0;
+    }
+
     void Renderer2D::Init() {
         VANTA_PROFILE_RENDER_FUNCTION();
 
@@ -143,18 +252,25 @@ namespace Vanta {
         s_Data.LineVAO = VertexArray::Create();
 
         // Create VBOs
-        s_Data.QuadVBO = VertexBuffer::Create(s_Data.MaxVerts * sizeof(QuadVertex));
-        s_Data.QuadVBO->SetLayout(QuadVertex::Layout());
+        // Batches are written straight into mapped memory, and each region fits a frame of them.
+        // Regions are only left at the end of a frame, so recorded quad batches can be drawn together.
+        s_Data.QuadVBO = StreamingVertexBuffer::Create(s_Data.MaxQuads * sizeof(QuadInstance) * RenderData::QuadBatchesPerFrame);
+        s_Data.QuadVBO->SetLayout(QuadInstanceLayout());
         s_Data.QuadVAO->AddVertexBuffer(s_Data.QuadVBO);
 
-        s_Data.CircleVBO = VertexBuffer::Create(s_Data.MaxVerts * sizeof(CircleVertex));
+        s_Data.CircleVBO = StreamingVertexBuffer::Create(s_Data.MaxVerts * sizeof(CircleVertex) * RenderData::ShapeBatchesPerFrame);
         s_Data.CircleVBO->SetLayout(CircleVertex::Layout());
         s_Data.CircleVAO->AddVertexBuffer(s_Data.CircleVBO);
 
-        s_Data.LineVBO = VertexBuffer::Create(s_Data.MaxVerts * sizeof(LineVertex));
+        s_Data.LineVBO = StreamingVertexBuffer::Create(s_Data.MaxVerts * sizeof(LineVertex) * RenderData::ShapeBatchesPerFrame);
         s_Data.LineVBO->SetLayout(LineVertex::Layout());
         s_Data.LineVAO->AddVertexBuffer(s_Data.LineVBO);
 
+        // Draws are offset by whole vertices, so the layouts must match the structs exactly
+        VANTA_CORE_ASSERT(s_Data.QuadVBO->GetLayout().GetStride() == sizeof(QuadInstance), "Quad instance layout doesn't match struct!");
+        VANTA_CORE_ASSERT(s_Data.CircleVBO->GetLayout().GetStride() == sizeof(CircleVertex), "Circle vertex layout doesn't match struct!");
+        VANTA_CORE_ASSERT(s_Data.LineVBO->GetLayout().GetStride() == sizeof(LineVertex), "Line vertex layout doesn't match struct!");
+
         { // Create index buffer
             uint* indices = new uint[s_Data.MaxIndices];
 
@@ -169,8 +285,9 @@ namespace Vanta {
                 offset += 4;
             }
 
-            Ref<IndexBuffer> qib = IndexBuffer::Create(indices, s_Data.MaxIndices);
-            s_Data.QuadVAO->SetIndexBuffer(qib);
+            // Quads are instanced, so they only need the indices of one
+            s_Data.QuadIBO = IndexBuffer::Create(indices, s_Data.QuadIndices);
+            s_Data.QuadVAO->SetIndexBuffer(s_Data.QuadIBO);
 
             Ref<IndexBuffer> cib = IndexBuffer::Create(indices, s_Data.MaxIndices);
             s_Data.CircleVAO->SetIndexBuffer(cib);
@@ -178,11 +295,6 @@ namespace Vanta {
             delete[] indices;
         }
 
-        // Create dynamic vertex buffers
-        s_Data.QuadVertexBuffer = new QuadVertex[s_Data.MaxVerts];
-        s_Data.CircleVertexBuffer = new CircleVertex[s_Data.MaxVerts];
-        s_Data.LineVertexBuffer = new LineVertex[s_Data.MaxVerts];
-
         // Load shaders
         s_Data.QuadShader = Shader::Create(Engine::RuntimeResourceDirectory() / "Shaders/Renderer2D_Quad.glsl");
         s_Data.CircleShader = Shader::Create(Engine::RuntimeResourceDirectory() / "Shaders/Renderer2D_Circle.glsl");
@@ -190,18 +302,57 @@ namespace Vanta {
 
         // Setup white texture
         constexpr uint32 white = 0xffffffff;
-        s_Data.TextureSlots[0] = Texture2D::Create(1, 1);
-        s_Data.TextureSlots[0]->SetData(&white, sizeof(uint32));
+        s_Data.WhiteTexture = Texture2D::Create(1, 1);
+        s_Data.WhiteTexture->SetData(&white, sizeof(uint32));
+        s_Data.WhiteTextureLocation = s_Data.TextureArrays.Place(s_Data.WhiteTexture);
+        VANTA_CORE_ASSERT(s_Data.WhiteTextureLocation.Layer == 0, "White texture must be the first layer of its page!");
 
         // Setup uniforms
         s_Data.CameraUniformBuffer = UniformBuffer::Create(sizeof(RenderData::CameraData), 0);
+
+        // Setup indirect submission
+        s_Data.IndirectFrameCount = s_Data.QuadVBO->GetRegionCount();
+        s_Data.IndirectFrame = 0;
+        CreateIndirectBuffers(RenderData::InitialIndirectBatches);
+        s_Data.QuadCommands.reserve(RenderData::InitialIndirectBatches);
+        s_Data.BatchStates.reserve(RenderData::InitialIndirectBatches);
+
+        RenderData::BatchState identity;
+        for (uint i = 0; i < RenderData::MaxTextureSlots; i++)
+            identity.Units[i] = i;
+        s_Data.IdentityBatchState = StorageBuffer::Create(sizeof(RenderData::BatchState), 1);
+        s_Data.IdentityBatchState->SetData(&identity, sizeof(RenderData::BatchState));
+
+        // Headless runs record every batch as a draw of its own, unless asked otherwise
+        s_Data.SubmitMode = GraphicsAPI::GetAPI() == GraphicsAPI::OpenGL ? Submission::Indirect : Submission::Immediate;
     }
 
     void Renderer2D::Shutdown() {
         VANTA_PROFILE_RENDER_FUNCTION();
-        delete[] s_Data.QuadVertexBuffer;
-        delete[] s_Data.CircleVertexBuffer;
-        delete[] s_Data.LineVertexBuffer;
+
+        s_Data.QuadInstanceBuffer = nullptr;
+        s_Data.CircleVertexBuffer = nullptr;
+        s_Data.LineVertexBuffer = nullptr;
+
+        s_Data.QuadVBO = nullptr;
+        s_Data.QuadIBO = nullptr;
+        s_Data.CircleVBO = nullptr;
+        s_Data.LineVBO = nullptr;
+
+        s_Data.QuadCommandBuffer = nullptr;
+        s_Data.BatchStateBuffer = nullptr;
+        s_Data.IdentityBatchState = nullptr;
+        s_Data.QuadCommands.clear();
+        s_Data.BatchStates.clear();
+        s_Data.UnitCount = 0;
+        s_Data.IndirectFrameCapacity = 0;
+        s_Data.IndirectFrame = 0;
+        s_Data.IndirectHead = 0;
+
+        s_Data.TextureArrays.Clear();
+        s_Data.PageSlots.clear();
+        s_Data.WhiteTexture = nullptr;
+        s_Data.LastTexture = nullptr;
     }
 
     void Renderer2D::SceneBegin(Camera* camera) {
@@ -217,6 +368,26 @@ namespace Vanta {
     void Renderer2D::SceneEnd() {
         VANTA_PROFILE_RENDER_FUNCTION();
         BatchFlush();
+        SubmitQuadBatches();
+    }
+
+    void Renderer2D::FrameEnd() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        // Everything drawn this frame is submitted, so each region is fenced once
+        SubmitQuadBatches();
+        s_Data.QuadVBO->NextFrame();
+        s_Data.CircleVBO->NextFrame();
+        s_Data.LineVBO->NextFrame();
+
+        s_Data.IndirectFrame = (s_Data.IndirectFrame + 1) % s_Data.IndirectFrameCount;
+        s_Data.IndirectHead = 0;
+    }
+
+    void Renderer2D::Flush() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+        NextBatch();
+        SubmitQuadBatches();
     }
 
     void Renderer2D::NextBatch() {
@@ -225,60 +396,155 @@ namespace Vanta {
     }
 
     void Renderer2D::BatchBegin() {
-        s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBuffer;
-        s_Data.QuadIndexCount = 0;
+        // Recorded batches read the current region, so they're drawn before it's left behind
+        if (!s_Data.QuadVBO->Fits(sizeof(QuadInstance)))
+            SubmitQuadBatches();
+
+        // Only as much as a single draw needs has to fit, the batch takes whatever is left of the region
+        s_Data.QuadInstanceBuffer = (QuadInstance*)s_Data.QuadVBO->Map(sizeof(QuadInstance));
+        s_Data.CircleVertexBuffer = (CircleVertex*)s_Data.CircleVBO->Map(Quad::VERTEX_COUNT * sizeof(CircleVertex));
+        s_Data.LineVertexBuffer = (LineVertex*)s_Data.LineVBO->Map(2 * sizeof(LineVertex));
+
+        s_Data.QuadInstanceBufferPtr = s_Data.QuadInstanceBuffer;
+        s_Data.QuadInstanceCount = 0;
+        s_Data.QuadInstanceCapacity = (uint)std::min<usize>(s_Data.MaxQuads, s_Data.QuadVBO->GetMappedSize() / sizeof(QuadInstance));
 
         s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBuffer;
         s_Data.CircleIndexCount = 0;
+        s_Data.CircleVertexCapacity = (uint)std::min<usize>(s_Data.MaxVerts, s_Data.CircleVBO->GetMappedSize() / sizeof(CircleVertex));
 
         s_Data.LineVertexBufferPtr = s_Data.LineVertexBuffer;
         s_Data.LineVertexCount = 0;
+        s_Data.LineVertexCapacity = (uint)std::min<usize>(s_Data.MaxVerts, s_Data.LineVBO->GetMappedSize() / sizeof(LineVertex));
 
         s_Data.TextureSlotIdx = 1;
+        s_Data.BatchIndex++;
+
+        // The white texture's page is always bound to slot 0, so untextured quads need no lookup
+        const uint32 whitePage = s_Data.WhiteTextureLocation.Page;
+        if (whitePage >= s_Data.PageSlots.size())
+            s_Data.PageSlots.resize(whitePage + 1);
+        s_Data.PageSlots[whitePage] = { s_Data.BatchIndex, 0 };
+        s_Data.TextureSlots[0] = whitePage;
     }
 
     void Renderer2D::BatchFlush() {
         // Draw quads
-        if (s_Data.QuadIndexCount != 0) {
-            usize dataSize = (usize)((uintptr_t)s_Data.QuadVertexBufferPtr - (uintptr_t)s_Data.QuadVertexBuffer);
-            s_Data.QuadVBO->SetData(s_Data.QuadVertexBuffer, dataSize);
+        if (s_Data.QuadInstanceCount != 0) {
+            uint baseInstance = s_Data.QuadVBO->Commit(s_Data.QuadInstanceCount * sizeof(QuadInstance));
+            s_Data.Stats.BatchCount++;
 
-            // Bind resources
-            s_Data.QuadShader->Bind();
+            if (s_Data.SubmitMode == Submission::Indirect) {
+                RecordQuadBatch(baseInstance);
+            }
+            else {
+                // Bind resources
+                s_Data.QuadShader->Bind();
+                s_Data.IdentityBatchState->Bind();
 
-            for (uint i = 0; i < s_Data.TextureSlotIdx; i++)
-                s_Data.TextureSlots[i]->Bind(i);
+                for (uint i = 0; i < s_Data.TextureSlotIdx; i++)
+                    s_Data.TextureArrays.GetArray(s_Data.TextureSlots[i])->Bind(i);
 
-            RenderCommand::DrawIndexed(s_Data.QuadVAO, s_Data.QuadIndexCount);
-            s_Data.Stats.DrawCalls++; 
+                RenderCommand::DrawIndexedInstanced(s_Data.QuadVAO, s_Data.QuadIndices, s_Data.QuadInstanceCount, baseInstance);
+                s_Data.Stats.DrawCalls++;
+            }
         }
 
+        // Circles and lines are drawn right away, so recorded quads go first to keep them in order
+        if (s_Data.CircleIndexCount != 0 || s_Data.LineVertexCount != 0)
+            SubmitQuadBatches();
+
         // Draw circles
         if (s_Data.CircleIndexCount != 0) {
             usize dataSize = (usize)((uintptr_t)s_Data.CircleVertexBufferPtr - (uintptr_t)s_Data.CircleVertexBuffer);
-            s_Data.CircleVBO->SetData(s_Data.CircleVertexBuffer, dataSize);
+            uint baseVertex = s_Data.CircleVBO->Commit(dataSize);
 
             // Bind resources
             s_Data.CircleShader->Bind();
 
-            RenderCommand::DrawIndexed(s_Data.CircleVAO, s_Data.CircleIndexCount);
+            RenderCommand::DrawIndexed(s_Data.CircleVAO, s_Data.CircleIndexCount, baseVertex);
             s_Data.Stats.DrawCalls++;
         }
 
         // Draw lines
         if (s_Data.LineVertexCount != 0) {
             usize dataSize = (usize)((uintptr_t)s_Data.LineVertexBufferPtr - (uintptr_t)s_Data.LineVertexBuffer);
-            s_Data.LineVBO->SetData(s_Data.LineVertexBuffer, dataSize);
+            uint firstVertex = s_Data.LineVBO->Commit(dataSize);
 
             // Bind resources
             s_Data.LineShader->Bind();
 
             RenderCommand::SetLineWidth(s_Data.LineWidth);
-            RenderCommand::DrawLines(s_Data.LineVAO, s_Data.LineVertexCount);
+            RenderCommand::DrawLines(s_Data.LineVAO, s_Data.LineVertexCount, firstVertex);
             s_Data.Stats.DrawCalls++;
         }
     }
 
+    void Renderer2D::RecordQuadBatch(uint baseInstance) {
+        auto unitOf = [](uint32 page) {
+            auto end = s_Data.UnitPages.begin() + s_Data.UnitCount;
+            return (uint)(std::find(s_Data.UnitPages.begin(), end, page) - s_Data.UnitPages.begin());
+        };
+
+        // Every page of the batch must be bound alongside those of the batches already recorded
+        uint newPages = 0;
+        for (uint i = 0; i < s_Data.TextureSlotIdx; i++) {
+            if (unitOf(s_Data.TextureSlots[i]) == s_Data.UnitCount)
+                newPages++;
+        }
+        if (s_Data.UnitCount + newPages > RenderData::MaxTextureUnits)
+            SubmitQuadBatches();
+
+        RenderData::BatchState& state = s_Data.BatchStates.emplace_back();
+        for (uint i = 0; i < s_Data.TextureSlotIdx; i++) {
+            const uint32 page = s_Data.TextureSlots[i];
+            uint unit = unitOf(page);
+            if (unit == s_Data.UnitCount)
+                s_Data.UnitPages[s_Data.UnitCount++] = page;
+            state.Units[i] = unit;
+        }
+
+        DrawIndexedIndirectCommand& command = s_Data.QuadCommands.emplace_back();
+        command.IndexCount = s_Data.QuadIndices;
+        command.InstanceCount = s_Data.QuadInstanceCount;
+        command.BaseInstance = baseInstance;
+    }
+
+    void Renderer2D::SubmitQuadBatches() {
+        if (s_Data.QuadCommands.empty())
+            return;
+
+        const uint count = (uint)s_Data.QuadCommands.size();
+
+        // Append to the frame's region, or grow past what the frame has outgrown.
+        // Replaced buffers stay alive for as long as earlier draws read them, so nothing in flight is written over.
+        uint first = (s_Data.IndirectHead + RenderData::BatchStateAlignment - 1) / RenderData::BatchStateAlignment * RenderData::BatchStateAlignment;
+        if (first + count > s_Data.IndirectFrameCapacity) {
+            CreateIndirectBuffers(std::max(s_Data.IndirectFrameCapacity * 2, count));
+            first = 0;
+        }
+        s_Data.IndirectHead = first + count;
+
+        const uint offset = s_Data.IndirectFrame * s_Data.IndirectFrameCapacity + first;
+        const uint32 stateSize = count * sizeof(RenderData::BatchState);
+        s_Data.QuadCommandBuffer->SetData(s_Data.QuadCommands.data(), count, offset);
+        s_Data.BatchStateBuffer->SetData(s_Data.BatchStates.data(), stateSize, offset * sizeof(RenderData::BatchState));
+
+        // Bind resources
+        s_Data.QuadShader->Bind();
+        s_Data.BatchStateBuffer->BindRange(offset * sizeof(RenderData::BatchState), stateSize);
+
+        for (uint i = 0; i < s_Data.UnitCount; i++)
+            s_Data.TextureArrays.GetArray(s_Data.UnitPages[i])->Bind(i);
+
+        RenderCommand::MultiDrawIndexedIndirect(s_Data.QuadVAO, s_Data.QuadCommandBuffer, count, offset);
+        s_Data.Stats.DrawCalls++;
+
+        s_Data.QuadCommands.clear();
+        s_Data.BatchStates.clear();
+        s_Data.UnitCount = 0;
+    }
+
     // translation * size
     static glm::mat4 CalcTransformMatrix(const glm::vec3& pos, const glm::vec2& size) {
         glm::mat4 transform(1.f);
@@ -339,58 +605,183 @@ namespace Vanta {
     void Renderer2D::DrawQuad(const glm::mat4& transform, const glm::vec4& color, int entityID) {
         VANTA_PROFILE_RENDER_FUNCTION();
 
-        if (s_Data.QuadIndexCount >= s_Data.MaxIndices - 6)
+        if (s_Data.QuadInstanceCount >= s_Data.QuadInstanceCapacity)
             NextBatch();
 
-        for (usize i = 0; i < Quad::VERTEX_COUNT; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * Quad::VERTEX_POS[i];
-            s_Data.QuadVertexBufferPtr->Color = color;
-            s_Data.QuadVertexBufferPtr->TexID = 0;
-            s_Data.QuadVertexBufferPtr->TexCoords = Quad::TEX_COORDS[i];
-            s_Data.QuadVertexBufferPtr->TilingFactor = 1;
-            s_Data.QuadVertexBufferPtr->EntityID = entityID;
-            s_Data.QuadVertexBufferPtr++;
-        }
-        s_Data.QuadIndexCount += 6;
-
-        s_Data.Stats.QuadCount++;
+        DrawQuadInstance(transform, color, 0, 1.f, entityID);
     }
 
     void Renderer2D::DrawQuad(const glm::mat4& transform, const Ref<Texture2D>& tex, float tilingFactor, const glm::vec4& tint, int entityID) {
         VANTA_PROFILE_RENDER_FUNCTION();
 
-        if (s_Data.QuadIndexCount >= s_Data.MaxIndices - 6)
+        if (s_Data.QuadInstanceCount >= s_Data.QuadInstanceCapacity)
             NextBatch();
 
         uint texID = BatchTexture(tex);
+        DrawQuadInstance(transform, tint, texID, tilingFactor, entityID);
+    }
 
-        for (usize i = 0; i < Quad::VERTEX_COUNT; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * Quad::VERTEX_POS[i];
-            s_Data.QuadVertexBufferPtr->Color = tint;
-            s_Data.QuadVertexBufferPtr->TexID = texID;
-            s_Data.QuadVertexBufferPtr->TexCoords = Quad::TEX_COORDS[i];
-            s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr->EntityID = entityID;
-            s_Data.QuadVertexBufferPtr++;
+    void Renderer2D::DrawQuadInstance(const glm::mat4& transform, const glm::vec4& color, uint texID, float tilingFactor, int entityID) {
+        QuadInstance& instance = *s_Data.QuadInstanceBufferPtr++;
+        instance = QuadInstance(transform, color, tilingFactor, entityID);
+        instance.TexID = (int)texID;
+        s_Data.QuadInstanceCount++;
+
+        s_Data.Stats.QuadCount++;
+        s_Data.Stats.InstanceCount++;
+    }
+
+    void Renderer2D::DrawQuads(const QuadList& quads) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        for (usize i = 0; i < quads.m_Instances.size(); i++) {
+            if (s_Data.QuadInstanceCount >= s_Data.QuadInstanceCapacity)
+                NextBatch();
+
+            const Ref<Texture2D>* tex = quads.m_Textures[i];
+            uint texID = tex ? BatchTexture(*tex) : 0;
+
+            QuadInstance& instance = *s_Data.QuadInstanceBufferPtr++;
+            instance = quads.m_Instances[i];
+            instance.TexID = (int)texID;
+            s_Data.QuadInstanceCount++;
         }
-        s_Data.QuadIndexCount += 6;
+
+        s_Data.Stats.QuadCount += quads.m_Instances.size();
+        s_Data.Stats.InstanceCount += quads.m_Instances.size();
+    }
+
+    void Renderer2D::DrawQuad(const QuadList& quads, usize index) {
+        if (s_Data.QuadInstanceCount >= s_Data.QuadInstanceCapacity)
+            NextBatch();
+
+        const Ref<Texture2D>* tex = quads.m_Textures[index];
+        uint texID = tex ? BatchTexture(*tex) : 0;
+
+        QuadInstance& instance = *s_Data.QuadInstanceBufferPtr++;
+        instance = quads.m_Instances[index];
+        instance.TexID = (int)texID;
+        s_Data.QuadInstanceCount++;
 
         s_Data.Stats.QuadCount++;
+        s_Data.Stats.InstanceCount++;
+    }
+
+    usize Renderer2D::BakeQuads(const QuadList& quads, usize first, StaticQuadBatch& batch) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        batch = StaticQuadBatch();
+        batch.m_Pages.push_back(s_Data.WhiteTextureLocation.Page);
+
+        std::vector<QuadInstance> instances;
+        instances.reserve(std::min<usize>(quads.Size() - first, s_Data.MaxQuads));
+
+        // Slots are only assigned within the batch, so it doesn't depend on what's drawn around it
+        usize i = first;
+        for (; i < quads.Size() && instances.size() < s_Data.MaxQuads; i++) {
+            const Ref<Texture2D>* tex = quads.m_Textures[i];
+
+            uint texID = 0;
+            if (tex && IsDrawable(*tex)) {
+                const TextureLocation location = s_Data.TextureArrays.Place(*tex);
+
+                auto slot = std::find(batch.m_Pages.begin(), batch.m_Pages.end(), location.Page);
+                if (slot == batch.m_Pages.end()) {
+                    if (batch.m_Pages.size() >= s_Data.MaxTextureSlots)
+                        break;
+                    slot = batch.m_Pages.insert(batch.m_Pages.end(), location.Page);
+                }
+
+                if (std::find(batch.m_Textures.begin(), batch.m_Textures.end(), *tex) == batch.m_Textures.end())
+                    batch.m_Textures.push_back(*tex);
+
+                texID = (uint)(slot - batch.m_Pages.begin()) | (location.Layer << RenderData::TexSlotBits);
+            }
+
+            QuadInstance& instance = instances.emplace_back(quads.m_Instances[i]);
+            instance.TexID = (int)texID;
+        }
+
+        if (instances.empty())
+            return 0;
+
+        // Written once and drawn many times, so it's uploaded as a regular static buffer
+        batch.m_VBO = VertexBuffer::Create((float*)instances.data(), (uint)(instances.size() * sizeof(QuadInstance) / sizeof(float)));
+        batch.m_VBO->SetLayout(QuadInstanceLayout());
+        batch.m_VAO = VertexArray::Create();
+        batch.m_VAO->AddVertexBuffer(batch.m_VBO);
+        batch.m_VAO->SetIndexBuffer(s_Data.QuadIBO);
+        batch.m_InstanceCount = (uint)instances.size();
+
+        return i - first;
+    }
+
+    void Renderer2D::DrawQuads(const StaticQuadBatch& batch) {
+        DrawQuads(std::vector<const StaticQuadBatch*>{ &batch });
+    }
+
+    void Renderer2D::DrawQuads(const std::vector<const StaticQuadBatch*>& batches) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        if (std::all_of(batches.begin(), batches.end(), [](const StaticQuadBatch* batch) { return batch->IsEmpty(); }))
+            return;
+
+        // Keep the batches in submission order
+        NextBatch();
+        SubmitQuadBatches();
+
+        // Textures stay placed while the batches hold them, this only refreshes changed data.
+        // Done before anything is bound, since placing a texture may replace a page's array.
+        for (const StaticQuadBatch* batch : batches) {
+            for (const Ref<Texture2D>& tex : batch->m_Textures)
+                s_Data.TextureArrays.Place(tex);
+        }
+
+        s_Data.QuadShader->Bind();
+        s_Data.IdentityBatchState->Bind();
+
+        // Neighbouring batches mostly share pages, so they're left bound between them
+        std::array<uint32, RenderData::MaxTextureSlots> bound;
+        bound.fill(std::numeric_limits<uint32>::max());
+
+        for (const StaticQuadBatch* batch : batches) {
+            if (batch->IsEmpty())
+                continue;
+
+            for (uint i = 0; i < (uint)batch->m_Pages.size(); i++) {
+                if (bound[i] != batch->m_Pages[i]) {
+                    s_Data.TextureArrays.GetArray(batch->m_Pages[i])->Bind(i);
+                    bound[i] = batch->m_Pages[i];
+                }
+            }
+
+            RenderCommand::DrawIndexedInstanced(batch->m_VAO, s_Data.QuadIndices, batch->m_InstanceCount);
+            s_Data.Stats.DrawCalls++;
+            s_Data.Stats.BatchCount++;
+            s_Data.Stats.QuadCount += batch->m_InstanceCount;
+            s_Data.Stats.InstanceCount += batch->m_InstanceCount;
+        }
     }
 
-    void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4& color, float thickness, float fade, int entityID) {
+    void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4& color, float thickness, float fade, [[maybe_unused]] int entityID) {
         VANTA_PROFILE_RENDER_FUNCTION();
 
-        if (s_Data.CircleIndexCount >= s_Data.MaxIndices - 6)
-            NextBatch(); 
+        // Every circle is four vertices and six indices, so the vertex limit covers both
+        if (s_Data.CircleIndexCount / 6 * Quad::VERTEX_COUNT + Quad::VERTEX_COUNT > s_Data.CircleVertexCapacity)
+            NextBatch();
+
+        // Shared by every corner, so only packed once
+        const uint32 packedColor = glm::packUnorm4x8(color);
+        const uint32 packedThicknessFade = glm::packUnorm2x16(glm::vec2(thickness, fade));
 
         for (usize i = 0; i < Quad::VERTEX_COUNT; i++) {
             s_Data.CircleVertexBufferPtr->WorldPosition = transform * Quad::VERTEX_POS[i];
-            s_Data.CircleVertexBufferPtr->LocalPosition = Quad::VERTEX_POS[i] *2.0f;
-            s_Data.CircleVertexBufferPtr->Color = color;
-            s_Data.CircleVertexBufferPtr->Thickness = thickness;
-            s_Data.CircleVertexBufferPtr->Fade = fade;
+            s_Data.CircleVertexBufferPtr->LocalPosition = glm::packHalf2x16(glm::vec2(Quad::VERTEX_POS[i]) * 2.0f);
+            s_Data.CircleVertexBufferPtr->Color = packedColor;
+            s_Data.CircleVertexBufferPtr->ThicknessFade = packedThicknessFade;
+#ifdef VANTA_RENDER_ENTITY_ID
             s_Data.CircleVertexBufferPtr->EntityID = entityID;
+#endif
             s_Data.CircleVertexBufferPtr++;
         }
         s_Data.CircleIndexCount += 6;
@@ -398,20 +789,26 @@ namespace Vanta {
         s_Data.Stats.QuadCount++;
     }
 
-    void Renderer2D::DrawLine(const glm::vec3& beg, const glm::vec3& end, const glm::vec4& color, int entityID) {
+    void Renderer2D::DrawLine(const glm::vec3& beg, const glm::vec3& end, const glm::vec4& color, [[maybe_unused]] int entityID) {
         VANTA_PROFILE_RENDER_FUNCTION();
 
-        if (s_Data.LineVertexCount >= s_Data.MaxVerts - 2)
+        if (s_Data.LineVertexCount + 2 > s_Data.LineVertexCapacity)
             NextBatch();
 
+        const uint32 packedColor = glm::packUnorm4x8(color);
+
         s_Data.LineVertexBufferPtr->Position = beg;
-        s_Data.LineVertexBufferPtr->Color = color;
+        s_Data.LineVertexBufferPtr->Color = packedColor;
+#ifdef VANTA_RENDER_ENTITY_ID
         s_Data.LineVertexBufferPtr->EntityID = entityID;
+#endif
         s_Data.LineVertexBufferPtr++;
 
         s_Data.LineVertexBufferPtr->Position = end;
-        s_Data.LineVertexBufferPtr->Color = color;
+        s_Data.LineVertexBufferPtr->Color = packedColor;
+#ifdef VANTA_RENDER_ENTITY_ID
         s_Data.LineVertexBufferPtr->EntityID = entityID;
+#endif
         s_Data.LineVertexBufferPtr++;
 
         s_Data.LineVertexCount += 2;
@@ -451,23 +848,49 @@ namespace Vanta {
             DrawQuad(transform, sprite.Color, entityID);
     }
 
+    bool Renderer2D::IsDrawable(const Ref<Texture2D>& tex) {
+        // Textures without any data draw untextured
+        return tex && tex->IsValid() && tex->GetWidth() != 0 && tex->GetHeight() != 0;
+    }
+
     uint Renderer2D::BatchTexture(const Ref<Texture2D>& tex) {
-        if (!tex)
+        if (!IsDrawable(tex))
             return 0;
 
-        // Find texture, if it's already queued
-        for (uint i = 1; i < s_Data.TextureSlotIdx; i++) {
-            if (*s_Data.TextureSlots[i] == *tex)
-                return i;
+        if (tex.get() == s_Data.LastTexture && s_Data.LastTextureBatch == s_Data.BatchIndex)
+            return s_Data.LastTexID;
+
+        const TextureLocation location = s_Data.TextureArrays.Place(tex);
+        if (location.Page >= s_Data.PageSlots.size())
+            s_Data.PageSlots.resize(location.Page + 1);
+
+        // Bind the texture's page, if it isn't bound in this batch yet
+        RenderData::PageSlot& pageSlot = s_Data.PageSlots[location.Page];
+        if (pageSlot.BatchIndex != s_Data.BatchIndex) {
+            // Make sure there is a free slot, or start a new batch
+            if (s_Data.TextureSlotIdx >= s_Data.MaxTextureSlots)
+                NextBatch();
+
+            pageSlot = { s_Data.BatchIndex, s_Data.TextureSlotIdx };
+            s_Data.TextureSlots[s_Data.TextureSlotIdx++] = location.Page;
         }
 
-        // Make sure there is a free slot, or start a new batch
-        if (s_Data.TextureSlotIdx >= s_Data.MaxTextureSlots)
-            NextBatch();
+        VANTA_CORE_ASSERT(location.Layer <= (std::numeric_limits<int>::max() >> RenderData::TexSlotBits), "Texture layer doesn't fit in TexID!");
+
+        s_Data.LastTexture = tex.get();
+        s_Data.LastTextureBatch = s_Data.BatchIndex;
+        s_Data.LastTexID = pageSlot.Slot | (location.Layer << RenderData::TexSlotBits);
+        return s_Data.LastTexID;
+    }
 
-        // Insert texture into next slot
-        s_Data.TextureSlots[s_Data.TextureSlotIdx] = tex;
-        return s_Data.TextureSlotIdx++;
+    Renderer2D::Submission Renderer2D::GetSubmission() {
+        return s_Data.SubmitMode;
+    }
+
+    void Renderer2D::SetSubmission(Submission submission) {
+        // Draw anything recorded the old way first
+        SubmitQuadBatches();
+        s_Data.SubmitMode = submission;
     }
 
     float Renderer2D::GetLineWidth() {
@@ -485,4 +908,21 @@ namespace Vanta {
     void Renderer2D::ResetStats() {
         memset(&s_Data.Stats, 0, sizeof(Statistics));
     }
+
+    void Renderer2D::RecordCulling(usize visible, usize culled) {
+        s_Data.Stats.VisibleCount += visible;
+        s_Data.Stats.CulledCount += culled;
+    }
+
+    uint32 Renderer2D::GetTextureSortKey(const Texture2D* texture) {
+        if (!texture)
+            return s_Data.WhiteTextureLocation.Page;
+
+        if (Opt<TextureLocation> location = s_Data.TextureArrays.Find(*texture))
+            return location->Page;
+
+        // Pages count up from zero, so unplaced textures take the top half of the field
+        constexpr uint32 unplaced = 1u << (RenderQueue::TEXTURE_BITS - 1);
+        return unplaced | (texture->GetRendererID() & (unplaced - 1));
+    }
 }
@@ -1,16 +1,100 @@
 #pragma once
 #include "Vanta/Render/Camera.hpp"
 #include "Vanta/Render/Texture.hpp"
+#include "Vanta/Render/VertexArray.hpp"
+
+/// Entity IDs are drawn alongside colors, so the editor can pick entities under the cursor.
+/// Distribution builds have no editor, so their vertices leave them out.
+#ifndef VANTA_DISTRIB
+#   define VANTA_RENDER_ENTITY_ID
+#endif
 
 namespace Vanta {
 
     struct SpriteComponent;
 
+    /// <summary>
+    /// GPU record of a single quad. The vertex shader expands it into the quad's corners.
+    /// </summary>
+    struct QuadInstance {
+        glm::vec3 AxisX;        // Transformed X and Y axes of the unit quad
+        glm::vec3 AxisY;
+        glm::vec3 Translation;
+        uint32 Color;           // RGBA8
+        float TilingFactor;
+        int TexID;
+
+#ifdef VANTA_RENDER_ENTITY_ID
+        // Editor data
+        int EntityID = -1;
+#endif
+
+        QuadInstance() = default;
+        QuadInstance(const glm::mat4& transform, const glm::vec4& color, float tilingFactor, int entityID);
+    };
+
+    /// <summary>
+    /// List of quads built apart from the renderer's batch state, so it can be filled on any thread.
+    /// Texture slots are only assigned once the list is submitted with `Renderer2D::DrawQuads`.
+    /// Textures are referenced, not copied, and must outlive the submission.
+    /// </summary>
+    class QuadList {
+    public:
+        void Clear();
+        void Reserve(usize count);
+
+        void Add(const glm::mat4& transform, const glm::vec4& color, int entityID = -1);
+        void Add(const glm::mat4& transform, const Ref<Texture2D>& tex, float tilingFactor = 1.f, const glm::vec4& tint = glm::vec4(1.f, 1.f, 1.f, 1.f), int entityID = -1);
+        void AddSprite(const glm::mat4& transform, const SpriteComponent& sprite, int entityID);
+
+        usize Size() const { return m_Instances.size(); }
+        bool IsEmpty() const { return m_Instances.empty(); }
+
+    private:
+        std::vector<QuadInstance> m_Instances;
+        std::vector<const Ref<Texture2D>*> m_Textures; // Null draws untextured
+
+        friend class Renderer2D;
+    };
+
+    /// <summary>
+    /// Quads baked into a vertex buffer of their own, so they can be drawn again in a single call
+    /// for as long as they don't change. Built by `Renderer2D::BakeQuads`.
+    /// Holds on to the textures it was baked with.
+    /// </summary>
+    class StaticQuadBatch {
+    public:
+        usize Size() const { return m_InstanceCount; }
+        bool IsEmpty() const { return m_InstanceCount == 0; }
+
+    private:
+        Ref<VertexArray> m_VAO;
+        Ref<VertexBuffer> m_VBO;
+        uint m_InstanceCount = 0;
+
+        std::vector<Ref<Texture2D>> m_Textures; // Placed again when drawn, in case their data changed
+        std::vector<uint32> m_Pages;            // Texture array page bound to each slot
+
+        friend class Renderer2D;
+    };
+
     class Renderer2D {
     public:
+        /// <summary>
+        /// How batches of quads are handed to the GPU.
+        /// </summary>
+        enum class Submission {
+            Immediate,  ///< Every batch is drawn as soon as it's full, binding its own textures
+            Indirect,   ///< Batches are recorded as indirect commands and drawn together in one multi-draw
+        };
+
         struct Statistics {
             usize DrawCalls = 0;
+            usize BatchCount = 0;     ///< Quad batches drawn; with indirect submission several share a draw call
             usize QuadCount = 0;
+            usize InstanceCount = 0;  ///< Quads drawn as instances, expanded on the GPU
+            usize VisibleCount = 0;   ///< Scene draws inside the camera's view
+            usize CulledCount = 0;    ///< Scene draws skipped for being out of view
             usize GetVertexCount() const { return QuadCount * 4; }
             usize GetIndexCount() const  { return QuadCount * 6; }
         };
@@ -21,6 +105,12 @@ namespace Vanta {
         static void SceneBegin(Camera* camera);
         static void SceneEnd();
 
+        /// <summary>
+        /// Finish drawing the frame. Streaming buffers move on to the next frame's memory,
+        /// waiting for the GPU to be done with it.
+        /// </summary>
+        static void FrameEnd();
+
         static void DrawQuad(const glm::vec2& pos, const glm::vec2& size, const glm::vec4& color);
         static void DrawQuad(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color);
         static void DrawQuad(const glm::vec2& pos, const glm::vec2& size, const Ref<Texture2D>& tex, float tilingFactor = 1.f, const glm::vec4& tint = glm::vec4(1.f, 1.f, 1.f, 1.f));
@@ -42,13 +132,62 @@ namespace Vanta {
         static void DrawRect(const glm::vec3& pos, const glm::vec2& size, const glm::vec4& color, int entityID = -1);
 
         static void DrawSprite(const glm::mat4& transform, SpriteComponent& sprite, int entityID);
+
+        /// <summary>
+        /// Submit a list of quads, in order, as though every quad was drawn in turn.
+        /// </summary>
+        static void DrawQuads(const QuadList& quads);
+
+        /// <summary>
+        /// Submit a single quad of a list.
+        /// </summary>
+        static void DrawQuad(const QuadList& quads, usize index);
+
+        /// <summary>
+        /// Bake quads of a list into a batch of their own, starting at a given quad.
+        /// Baking stops once the batch runs out of texture slots.
+        /// Returns the number of quads baked.
+        /// </summary>
+        static usize BakeQuads(const QuadList& quads, usize first, StaticQuadBatch& batch);
+
+        /// <summary>
+        /// Draw a baked batch in a single call, after everything submitted before it.
+        /// </summary>
+        static void DrawQuads(const StaticQuadBatch& batch);
+
+        /// <summary>
+        /// Draw baked batches one after another as a single submission, after everything submitted before them.
+        /// Only texture slots that differ from the previous batch are bound again.
+        /// </summary>
+        static void DrawQuads(const std::vector<const StaticQuadBatch*>& batches);
+
+        /// <summary>
+        /// Draw everything submitted so far, so that anything submitted later is drawn over it.
+        /// Within a batch, quads, circles and lines are each drawn together.
+        /// </summary>
+        static void Flush();
         
+        static Submission GetSubmission();
+        static void SetSubmission(Submission submission);
+
         static float GetLineWidth();
         static void SetLineWidth(float width);
 
         static Statistics GetStats();
         static void ResetStats();
 
+        /// <summary>
+        /// Count draws that were culled before reaching the renderer.
+        /// </summary>
+        static void RecordCulling(usize visible, usize culled);
+
+        /// <summary>
+        /// Value for the texture field of a sort key, so draws sharing a texture array page sort together.
+        /// Textures that haven't been drawn yet have no page, and are kept apart from the pages until they do.
+        /// May be called from several threads at once, as long as nothing is drawn meanwhile.
+        /// </summary>
+        static uint32 GetTextureSortKey(const Texture2D* texture);
+
     private:
         Renderer2D() = delete;
         
@@ -56,6 +195,11 @@ namespace Vanta {
         static void BatchBegin();
         static void BatchFlush();
 
+        static void RecordQuadBatch(uint baseInstance);
+        static void SubmitQuadBatches();
+
+        static bool IsDrawable(const Ref<Texture2D>& tex);
         static uint BatchTexture(const Ref<Texture2D>& tex);
+        static void DrawQuadInstance(const glm::mat4& transform, const glm::vec4& color, uint texID, float tilingFactor, int entityID);
     };
 }
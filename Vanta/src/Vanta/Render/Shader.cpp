@@ -3,11 +3,13 @@
 #include "Vanta/Render/GraphicsAPI.hpp"
 
 #include "Platform/OpenGL/Shader.hpp"
+#include "Platform/Null/Shader.hpp"
 
 namespace Vanta {
 
     Ref<Shader> Shader::Create(const Path& path) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewRef<NullShader>(path);
         case GraphicsAPI::OpenGL: return NewRef<OpenGLShader>(path);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -17,6 +19,7 @@ namespace Vanta {
 
     Ref<Shader> Shader::Create(const std::string& name, const Path& filepath) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewRef<NullShader>(name, filepath);
         case GraphicsAPI::OpenGL: return NewRef<OpenGLShader>(name, filepath);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -66,6 +69,9 @@ namespace Vanta {
         case Type::Float2: return 2;
         case Type::Float3: return 3;
         case Type::Float4: return 4;
+        case Type::UNorm4x8:  return 4;
+        case Type::UNorm2x16: return 2;
+        case Type::Half2x16:  return 2;
         case Type::Mat3:   return 3; // 3 * float3
         case Type::Mat4:   return 4; // 4 * float4
         case Type::Bool:   return 1;
@@ -90,6 +96,9 @@ namespace Vanta {
         case Type::Float2: return 4 * 2;
         case Type::Float3: return 4 * 3;
         case Type::Float4: return 4 * 4;
+        case Type::UNorm4x8:  return 4;
+        case Type::UNorm2x16: return 4;
+        case Type::Half2x16:  return 4;
         case Type::Mat3:   return 4 * 3 * 3;
         case Type::Mat4:   return 4 * 4 * 4;
         case Type::Bool:   return 1;
@@ -11,6 +11,7 @@ namespace Vanta {
                 Int, Int2, Int3, Int4,
                 UInt, UInt2, UInt3, UInt4,
                 Float, Float2, Float3, Float4,
+                UNorm4x8, UNorm2x16, Half2x16, // Packed into 32 bits, read as floats
                 Mat3, Mat4,
                 Bool
             };
@@ -0,0 +1,19 @@
+#include "vantapch.hpp"
+#include "Vanta/Render/GraphicsAPI.hpp"
+#include "Vanta/Render/StorageBuffer.hpp"
+
+#include "Platform/OpenGL/StorageBuffer.hpp"
+#include "Platform/Null/StorageBuffer.hpp"
+
+namespace Vanta {
+
+    Ref<StorageBuffer> StorageBuffer::Create(uint32 size, uint32 binding) {
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullStorageBuffer>();
+        case GraphicsAPI::OpenGL: return NewBox<OpenGLStorageBuffer>(size, binding);
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+namespace Vanta {
+
+    /// <summary>
+    /// Shader storage buffer, for arrays of data too large or too variable for a uniform buffer.
+    /// Data is written straight into mapped memory, so callers must not write over data
+    /// the GPU may still be reading.
+    /// </summary>
+    class StorageBuffer {
+    public:
+        virtual ~StorageBuffer() = default;
+
+        /// <summary>
+        /// Make the buffer the one shaders read from its binding point.
+        /// Several buffers can share a binding point, the last bound one is used.
+        /// </summary>
+        virtual void Bind() const = 0;
+
+        /// <summary>
+        /// Bind only part of the buffer, so shaders index from its start.
+        /// The offset must be a multiple of `RANGE_ALIGNMENT`.
+        /// </summary>
+        virtual void BindRange(uint32 offset, uint32 size) const = 0;
+
+        /// Largest offset alignment a graphics API may require of bound ranges
+        static constexpr uint32 RANGE_ALIGNMENT = 256;
+
+        virtual void SetData(const void* data, uint32 size, uint32 offset = 0) = 0;
+
+        static Ref<StorageBuffer> Create(uint32 size, uint32 binding);
+    };
+}
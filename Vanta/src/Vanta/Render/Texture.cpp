@@ -3,11 +3,25 @@
 #include "Vanta/Render/GraphicsAPI.hpp"
 
 #include "Platform/OpenGL/Texture.hpp"
+#include "Platform/Null/Texture.hpp"
 
 namespace Vanta {
 
+    bool Texture::IsOpaqueData(const void* data, usize size, TextureFormat format) {
+        if (format != TextureFormat::RGBA8 || !data)
+            return true;
+
+        const uint8* pixels = static_cast<const uint8*>(data);
+        for (usize i = 3; i < size; i += 4) {
+            if (pixels[i] != 0 && pixels[i] != 0xff)
+                return false;
+        }
+        return true;
+    }
+
     Ref<Texture2D> Texture2D::Create(uint32 width, uint32 height) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullTexture2D>(width, height);
         case GraphicsAPI::OpenGL: return NewBox<OpenGLTexture2D>(width, height);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -17,10 +31,46 @@ namespace Vanta {
 
     Ref<Texture2D> Texture2D::Create(const Path& path) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullTexture2D>(path);
         case GraphicsAPI::OpenGL: return NewBox<OpenGLTexture2D>(path);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
             return nullptr;
         }
     }
+
+    Ref<Texture2D> Texture2D::CreatePlaceholder(const Path& path) {
+        Ref<Texture2D> texture;
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   texture = NewBox<NullTexture2D>(1, 1, path); break;
+        case GraphicsAPI::OpenGL: texture = NewBox<OpenGLTexture2D>(1, 1, path); break;
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+
+        constexpr uint32 white = 0xffffffff;
+        texture->SetData(&white, sizeof(uint32));
+        return texture;
+    }
+
+    Ref<Texture2DArray> Texture2DArray::Create(uint32 width, uint32 height, uint32 layerCount, TextureFormat format) {
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullTexture2DArray>(width, height, layerCount, format);
+        case GraphicsAPI::OpenGL: return NewBox<OpenGLTexture2DArray>(width, height, layerCount, format);
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+    }
+
+    Ref<Texture2DArray> Texture2DArray::CreateView(const Texture2D& texture) {
+        switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullTexture2DArray>(texture.GetWidth(), texture.GetHeight(), 1, texture.GetFormat());
+        case GraphicsAPI::OpenGL: return NewBox<OpenGLTexture2DArray>(texture);
+        default:
+            VANTA_UNREACHABLE("Invalid graphics API!");
+            return nullptr;
+        }
+    }
 }
@@ -2,6 +2,12 @@
 
 namespace Vanta {
 
+    enum class TextureFormat {
+        None = 0,
+        RGB8,
+        RGBA8,
+    };
+
     class Texture {
     public:
         virtual ~Texture() = default;
@@ -16,6 +22,18 @@ namespace Vanta {
 
         virtual uint32 GetWidth() const = 0;
         virtual uint32 GetHeight() const = 0;
+        virtual TextureFormat GetFormat() const = 0;
+
+        /// <summary>
+        /// Incremented every time the texture's data is set, so copies of it can tell they're stale.
+        /// </summary>
+        uint32 GetRevision() const { return m_Revision; }
+
+        /// <summary>
+        /// Whether every pixel is either fully opaque or fully transparent, so the texture can be drawn
+        /// without blending. Fully transparent pixels are discarded when drawn.
+        /// </summary>
+        bool IsOpaque() const { return m_Opaque; }
 
         virtual uint32 GetRendererID() const = 0;
 
@@ -23,15 +41,72 @@ namespace Vanta {
         virtual bool operator!=(const Texture& other) const = 0;
 
     protected:
+        uint32 m_Revision = 0;
+        bool m_Opaque = true;
+
         Texture() = default;
+
+        /// <summary>
+        /// Whether pixel data has no partially transparent pixels.
+        /// </summary>
+        static bool IsOpaqueData(const void* data, usize size, TextureFormat format);
     };
 
     class Texture2D : public Texture {
     public:
         virtual ~Texture2D() = default;
 
+        /// <summary>
+        /// Replace the texture's contents with a decoded image, resizing the texture to fit it.
+        /// </summary>
+        virtual void SetImage(const IO::Image& image) = 0;
+
         static Ref<Texture2D> Create(uint32 width, uint32 height);
         static Ref<Texture2D> Create(const Path& path);
+
+        /// <summary>
+        /// Create a white 1x1 texture standing in for an image that's still loading.
+        /// It keeps the image's path, and is given the image with `SetImage` once it's decoded.
+        /// </summary>
+        static Ref<Texture2D> CreatePlaceholder(const Path& path);
+    };
+
+    /// <summary>
+    /// Array of equally sized 2D textures, sampled as a single texture with a layer index.
+    /// </summary>
+    class Texture2DArray {
+    public:
+        virtual ~Texture2DArray() = default;
+
+        virtual void Bind(uint slot = 0) const = 0;
+
+        virtual uint32 GetWidth() const = 0;
+        virtual uint32 GetHeight() const = 0;
+        virtual uint32 GetLayerCount() const = 0;
+        virtual TextureFormat GetFormat() const = 0;
+
+        virtual uint32 GetRendererID() const = 0;
+
+        /// <summary>
+        /// Copy a texture into a layer, on the GPU. The texture must match the array's size and format.
+        /// </summary>
+        virtual void CopyLayer(uint32 layer, const Texture2D& source) = 0;
+
+        /// <summary>
+        /// Copy the first layers of another array, on the GPU. The arrays must match in size and format.
+        /// </summary>
+        virtual void CopyLayers(const Texture2DArray& source, uint32 layerCount) = 0;
+
+        static Ref<Texture2DArray> Create(uint32 width, uint32 height, uint32 layerCount, TextureFormat format);
+
+        /// <summary>
+        /// Create a single layer array that shares the storage of a texture, without copying it.
+        /// Changes to the texture's data show through, but it mustn't be written to with `CopyLayer`.
+        /// </summary>
+        static Ref<Texture2DArray> CreateView(const Texture2D& texture);
+
+    protected:
+        Texture2DArray() = default;
     };
 
     static inline bool operator==(const Ref<Texture2D>& first, const Ref<Texture2D>& second) {
@@ -0,0 +1,195 @@
+#include "vantapch.hpp"
+#include "Vanta/Render/TextureArrayCache.hpp"
+
+namespace Vanta {
+
+    static bool IsSameTexture(const std::weak_ptr<Texture2D>& tracked, const Ref<Texture2D>& texture) {
+        return !tracked.owner_before(texture) && !texture.owner_before(tracked);
+    }
+
+    TextureLocation TextureArrayCache::Place(const Ref<Texture2D>& texture) {
+        VANTA_CORE_ASSERT(texture, "Can't place null texture!");
+
+        auto it = m_Entries.find(texture.get());
+        if (it != m_Entries.end()) {
+            Entry& entry = it->second;
+            const bool same = IsSameTexture(entry.Texture, texture);
+            if (same && entry.Revision == texture->GetRevision())
+                return entry.Location;
+
+            // Refresh the copy if the texture's data has changed, but still fits its page.
+            // Direct pages share the texture's storage, so they're already up to date.
+            const Page& page = m_Pages[entry.Location.Page];
+            if (same && page.Width == texture->GetWidth() && page.Height == texture->GetHeight() && page.Format == texture->GetFormat()) {
+                if (!page.Direct)
+                    page.Array->CopyLayer(entry.Location.Layer, *texture);
+                entry.Revision = texture->GetRevision();
+                return entry.Location;
+            }
+
+            // Stale entry of a destroyed texture that had the same address,
+            // or of a texture that was resized and needs a matching page
+            Release(texture.get());
+        }
+
+        TextureLocation location = Allocate(texture);
+        Page& page = m_Pages[location.Page];
+        page.Owners[location.Layer] = texture.get();
+        if (!page.Direct)
+            page.Array->CopyLayer(location.Layer, *texture);
+        m_Entries.emplace(texture.get(), Entry{ texture, location, texture->GetRevision() });
+        return location;
+    }
+
+    Opt<TextureLocation> TextureArrayCache::Find(const Texture2D& texture) const {
+        auto it = m_Entries.find(&texture);
+        if (it == m_Entries.end() || it->second.Texture.expired())
+            return None;
+        return it->second.Location;
+    }
+
+    void TextureArrayCache::Clear() {
+        m_Entries.clear();
+        m_Pages.clear();
+    }
+
+    TextureLocation TextureArrayCache::Allocate(const Ref<Texture2D>& texture) {
+        const uint32 width = texture->GetWidth();
+        const uint32 height = texture->GetHeight();
+        const TextureFormat format = texture->GetFormat();
+
+        // Large textures would waste most of a page on layers that are never used
+        if (width >= DIRECT_SIZE || height >= DIRECT_SIZE)
+            return { AllocateDirect(texture), 0 };
+
+        bool seen = false;
+        for (uint32 i = 0; i < (uint32)m_Pages.size(); i++) {
+            const Page& page = m_Pages[i];
+            if (page.Width != width || page.Height != height || page.Format != format)
+                continue;
+
+            seen = true;
+            if (page.Direct)
+                continue;
+
+            uint32 layer = 0;
+            if (AllocateLayer(i, layer))
+                return { i, layer };
+        }
+
+        // Sizes that only show up once don't need a page to share
+        if (!seen)
+            return { AllocateDirect(texture), 0 };
+
+        // No room in any matching page, start another
+        Page page;
+        page.Array = Texture2DArray::Create(width, height, INITIAL_LAYERS, format);
+        page.Width = width;
+        page.Height = height;
+        page.Format = format;
+        m_Pages.push_back(std::move(page));
+
+        const uint32 pageIdx = (uint32)m_Pages.size() - 1;
+        uint32 layer = 0;
+        AllocateLayer(pageIdx, layer);
+        return { pageIdx, layer };
+    }
+
+    uint32 TextureArrayCache::AllocateDirect(const Ref<Texture2D>& texture) {
+        const auto findReleased = [this]() {
+            for (uint32 i = 0; i < (uint32)m_Pages.size(); i++) {
+                if (m_Pages[i].Direct && !m_Pages[i].Array)
+                    return i;
+            }
+            return (uint32)m_Pages.size();
+        };
+
+        // Page indices are handed out in locations, so released direct pages are refilled instead of erased
+        uint32 pageIdx = findReleased();
+        if (pageIdx == m_Pages.size()) {
+            for (uint32 i = 0; i < (uint32)m_Pages.size(); i++) {
+                if (m_Pages[i].Direct)
+                    Sweep(i);
+            }
+            pageIdx = findReleased();
+        }
+        if (pageIdx == m_Pages.size())
+            m_Pages.emplace_back();
+
+        Page& page = m_Pages[pageIdx];
+        page.Array = Texture2DArray::CreateView(*texture);
+        page.Width = texture->GetWidth();
+        page.Height = texture->GetHeight();
+        page.Format = texture->GetFormat();
+        page.Direct = true;
+        page.UsedLayers = 1;
+        page.FreeLayers.clear();
+        page.Owners.assign(1, nullptr);
+        return pageIdx;
+    }
+
+    bool TextureArrayCache::AllocateLayer(uint32 pageIdx, uint32& layer) {
+        Page& page = m_Pages[pageIdx];
+
+        if (page.FreeLayers.empty() && page.UsedLayers == page.Array->GetLayerCount()) {
+            // Reclaim layers of destroyed textures before growing
+            Sweep(pageIdx);
+
+            if (page.FreeLayers.empty()) {
+                const uint32 layerCount = page.Array->GetLayerCount();
+                if (layerCount >= MAX_LAYERS)
+                    return false;
+
+                // Grow by moving the layers over into a bigger array
+                auto array = Texture2DArray::Create(page.Width, page.Height, std::min(layerCount * 2, MAX_LAYERS), page.Format);
+                array->CopyLayers(*page.Array, page.UsedLayers);
+                page.Array = std::move(array);
+            }
+        }
+
+        if (!page.FreeLayers.empty()) {
+            layer = page.FreeLayers.back();
+            page.FreeLayers.pop_back();
+        }
+        else {
+            layer = page.UsedLayers++;
+            page.Owners.push_back(nullptr);
+        }
+        return true;
+    }
+
+    void TextureArrayCache::Release(const Texture2D* key) {
+        auto it = m_Entries.find(key);
+        if (it == m_Entries.end())
+            return;
+
+        const TextureLocation location = it->second.Location;
+        Page& page = m_Pages[location.Page];
+        m_Entries.erase(it);
+
+        // A direct page has nothing left to show
+        if (page.Direct) {
+            page.Array = nullptr;
+            page.Width = 0;
+            page.Height = 0;
+            page.Format = TextureFormat::None;
+            page.UsedLayers = 0;
+            page.Owners.clear();
+            return;
+        }
+
+        page.Owners[location.Layer] = nullptr;
+        page.FreeLayers.push_back(location.Layer);
+    }
+
+    void TextureArrayCache::Sweep(uint32 pageIdx) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        Page& page = m_Pages[pageIdx];
+        for (uint32 layer = 0; layer < page.UsedLayers; layer++) {
+            const Texture2D* key = page.Owners[layer];
+            if (key && m_Entries.at(key).Texture.expired())
+                Release(key);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "Vanta/Render/Texture.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Where a texture was placed in a `TextureArrayCache`.
+    /// </summary>
+    struct TextureLocation {
+        uint32 Page = 0;
+        uint32 Layer = 0;
+    };
+
+    /// <summary>
+    /// Copies 2D textures into layers of texture arrays, so textures can be told apart by a layer
+    /// index instead of taking a texture slot each.
+    /// Textures of the same size and format share a page, which is a single texture array.
+    /// Pages start with a single layer and double as they fill up, until they reach `MAX_LAYERS`,
+    /// then another page is started.
+    /// Large textures, and the first texture of each size, are given a page of their own that views
+    /// the texture directly instead of copying it.
+    /// Textures are tracked weakly; once one is destroyed, its layer is reused.
+    /// </summary>
+    class TextureArrayCache {
+    public:
+        static constexpr uint32 INITIAL_LAYERS = 1;
+        static constexpr uint32 MAX_LAYERS = 2048; // GL_MAX_ARRAY_TEXTURE_LAYERS guaranteed by OpenGL 4.5
+        static constexpr uint32 DIRECT_SIZE = 1024; // Textures this wide or high are never copied
+
+        TextureArrayCache() = default;
+        TextureArrayCache(const TextureArrayCache&) = delete;
+        TextureArrayCache& operator=(const TextureArrayCache&) = delete;
+
+        /// <summary>
+        /// Find the location of a texture, copying it into a page if it isn't in one yet,
+        /// or if its data has changed since it was copied.
+        /// A texture that was resized is moved to a page that matches its new size.
+        /// </summary>
+        TextureLocation Place(const Ref<Texture2D>& texture);
+
+        /// <summary>
+        /// Find where a texture was last placed, without placing it.
+        /// Doesn't change the cache, so it may be called from several threads while nothing is placed.
+        /// </summary>
+        Opt<TextureLocation> Find(const Texture2D& texture) const;
+
+        const Ref<Texture2DArray>& GetArray(uint32 page) const { return m_Pages[page].Array; }
+        usize GetPageCount() const { return m_Pages.size(); }
+
+        /// <summary>
+        /// Number of textures currently occupying a layer, including ones that have expired
+        /// but haven't been swept yet.
+        /// </summary>
+        usize GetTextureCount() const { return m_Entries.size(); }
+
+        void Clear();
+
+    private:
+        struct Entry {
+            std::weak_ptr<Texture2D> Texture;
+            TextureLocation Location;
+            uint32 Revision = 0;
+        };
+
+        struct Page {
+            Ref<Texture2DArray> Array;
+            uint32 Width = 0;
+            uint32 Height = 0;
+            TextureFormat Format = TextureFormat::None;
+            bool Direct = false;                     // Views a single texture, released along with it
+            uint32 UsedLayers = 0;                   // Layers handed out so far, including freed ones
+            std::vector<uint32> FreeLayers;
+            std::vector<const Texture2D*> Owners;    // Entry key per used layer, null if free
+        };
+
+        // Keyed by texture address. Entries are checked against the weak reference,
+        // since a new texture may be created at the address of a destroyed one.
+        std::unordered_map<const Texture2D*, Entry> m_Entries;
+        std::vector<Page> m_Pages;
+
+        TextureLocation Allocate(const Ref<Texture2D>& texture);
+        uint32 AllocateDirect(const Ref<Texture2D>& texture);
+        bool AllocateLayer(uint32 pageIdx, uint32& layer);
+        void Release(const Texture2D* key);
+        void Sweep(uint32 pageIdx);
+    };
+}
@@ -3,11 +3,13 @@
 #include "Vanta/Render/UniformBuffer.hpp"
 
 #include "Platform/OpenGL/UniformBuffer.hpp"
+#include "Platform/Null/UniformBuffer.hpp"
 
 namespace Vanta {
 
     Ref<UniformBuffer> UniformBuffer::Create(uint32 size, uint32 binding) {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullUniformBuffer>();
         case GraphicsAPI::OpenGL: return NewBox<OpenGLUniformBuffer>(size, binding);
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -3,11 +3,13 @@
 #include "Vanta/Render/GraphicsAPI.hpp"
 
 #include "Platform/OpenGL/VertexArray.hpp"
+#include "Platform/Null/VertexArray.hpp"
 
 namespace Vanta {
 
     Box<VertexArray> VertexArray::Create() {
         switch (GraphicsAPI::GetAPI()) {
+        case GraphicsAPI::None:   return NewBox<NullVertexArray>();
         case GraphicsAPI::OpenGL: return NewBox<OpenGLVertexArray>();
         default:
             VANTA_UNREACHABLE("Invalid graphics API!");
@@ -0,0 +1,698 @@
+#include "vantapch.hpp"
+#include "Vanta/Asset/AssetManager.hpp"
+#include "Vanta/Project/Project.hpp"
+#include "Vanta/Scene/BinarySerializer.hpp"
+#include "Vanta/Scene/Entity.hpp"
+#include "Vanta/Scripts/Field.hpp"
+#include "Vanta/Scripts/CSharp/ScriptEngine.hpp"
+#include "Vanta/Scripts/Native/ScriptEngine.hpp"
+
+namespace Vanta {
+
+    namespace BinaryScene {
+
+        constexpr char MAGIC[4] = { 'V', 'N', 'T', 'B' };
+        constexpr uint32 NO_INDEX = std::numeric_limits<uint32>::max();
+
+        enum class SectionType : uint32 {
+            Strings = 0,        // String table, other sections refer to strings by index
+            IDs,                // UUID of every entity
+            Names,              // Name of every entity
+            Transforms,         // Transform of every entity
+            Cameras,
+            Sprites,
+            CircleRenderers,
+            Rigidbodies2D,
+            BoxColliders2D,
+            CircleColliders2D,
+            CSharpScripts,
+            NativeScripts,
+            ScriptFields,       // Field values of every script, of both kinds
+            Count,
+        };
+
+        // Layout of the file:
+        //   FileHeader
+        //   SectionHeader[SectionCount]
+        //   Section data, each section aligned to 8 bytes
+        //
+        // Sections of IDs, names and transforms hold a record per entity.
+        // Other component sections hold the indices of the entities that have the component,
+        // padded to 8 bytes, then a record per entity in the same order.
+        // The string table holds `Count + 1` offsets into the character data that follows them.
+
+        struct FileHeader {
+            char Magic[4];
+            uint32 Version;
+            uint32 EntityCount;
+            uint32 SectionCount;
+            uint32 ActiveCamera;    // Entity index, or NO_INDEX
+            uint32 Reserved;
+        };
+
+        struct SectionHeader {
+            SectionType Type;
+            uint32 Count;           // Number of records
+            uint64 Offset;          // From the start of the file
+            uint64 Size;            // In bytes
+        };
+
+        struct TransformRecord {
+            glm::vec3 Position;
+            glm::vec3 Rotation;     // Radians
+            glm::vec3 Scale;
+        };
+
+        struct CameraRecord {
+            int32 ProjectionType;
+            float PerspectiveFOV;
+            float PerspectiveNear;
+            float PerspectiveFar;
+            float OrthographicSize;
+            float OrthographicNear;
+            float OrthographicFar;
+            uint32 FixedAspectRatio;
+        };
+
+        struct SpriteRecord {
+            uint32 Texture;         // String index of the texture path, or NO_INDEX
+            float TilingFactor;
+            glm::vec4 Color;
+        };
+
+        struct CircleRendererRecord {
+            glm::vec4 Color;
+            float Thickness;
+            float Fade;
+        };
+
+        struct Rigidbody2DRecord {
+            int32 BodyType;
+            uint32 FixedRotation;
+        };
+
+        struct BoxCollider2DRecord {
+            glm::vec2 Size;
+            glm::vec2 Offset;
+            float Density;
+            float Friction;
+            float Restitution;
+            float RollingResistance;
+        };
+
+        struct CircleCollider2DRecord {
+            float Radius;
+            glm::vec2 Offset;
+            float Density;
+            float Friction;
+            float Restitution;
+            float RollingResistance;
+        };
+
+        struct ScriptRecord {
+            uint32 Class;           // String index
+        };
+
+        struct ScriptFieldRecord {
+            uint32 Entity;
+            uint32 Native;          // Field of a native script, rather than a C# one
+            uint32 Name;            // String index
+            uint32 Type;            // ScriptFieldType
+            uint8 Value[16];
+        };
+
+        static_assert(sizeof(FileHeader) % 8 == 0 && sizeof(SectionHeader) % 8 == 0, "Headers must keep sections aligned!");
+
+        static usize IndexColumnSize(uint32 count) {
+            return ((usize)count * sizeof(uint32) + 7) & ~usize(7);
+        }
+
+        static usize GetFieldSize(Scripts::ScriptFieldType fieldType) {
+#define SCRIPT_FIELD_SIZE(fieldType, type) \
+    case Scripts::ScriptFieldType::fieldType: return sizeof(type);
+
+            switch (fieldType) {
+                SCRIPT_FIELD_SIZE(Bool, bool);
+                SCRIPT_FIELD_SIZE(Char, char);
+
+                SCRIPT_FIELD_SIZE(Int8, int8);
+                SCRIPT_FIELD_SIZE(Int16, int16);
+                SCRIPT_FIELD_SIZE(Int32, int32);
+                SCRIPT_FIELD_SIZE(Int64, int64);
+
+                SCRIPT_FIELD_SIZE(UInt8, uint8);
+                SCRIPT_FIELD_SIZE(UInt16, uint16);
+                SCRIPT_FIELD_SIZE(UInt32, uint32);
+                SCRIPT_FIELD_SIZE(UInt64, uint64);
+
+                SCRIPT_FIELD_SIZE(Float, float);
+                SCRIPT_FIELD_SIZE(Double, double);
+
+                SCRIPT_FIELD_SIZE(Vector2, glm::vec2);
+                SCRIPT_FIELD_SIZE(Vector3, glm::vec3);
+                SCRIPT_FIELD_SIZE(Vector4, glm::vec4);
+
+                SCRIPT_FIELD_SIZE(Entity, UUID);
+
+            default: return 0;
+            }
+#undef SCRIPT_FIELD_SIZE
+        }
+
+        class StringTable {
+        public:
+            uint32 Add(const std::string& string) {
+                auto [it, added] = m_Indices.try_emplace(string, (uint32)m_Strings.size());
+                if (added)
+                    m_Strings.push_back(&it->first);
+                return it->second;
+            }
+
+            const std::vector<const std::string*>& GetStrings() const { return m_Strings; }
+
+        private:
+            std::unordered_map<std::string, uint32> m_Indices;
+            std::vector<const std::string*> m_Strings;
+        };
+
+        class Writer {
+        public:
+            void Write(const StringTable& strings) {
+                const auto& list = strings.GetStrings();
+                Begin(SectionType::Strings, (uint32)list.size());
+
+                uint32 offset = 0;
+                Append(&offset, sizeof(uint32));
+                for (const std::string* string : list) {
+                    offset += (uint32)string->size();
+                    Append(&offset, sizeof(uint32));
+                }
+                for (const std::string* string : list)
+                    Append(string->data(), string->size());
+
+                End();
+            }
+
+            template<typename Record>
+            void Write(SectionType type, const std::vector<Record>& records) {
+                Begin(type, (uint32)records.size());
+                Append(records.data(), records.size() * sizeof(Record));
+                End();
+            }
+
+            template<typename Record>
+            void Write(SectionType type, const std::vector<uint32>& entities, const std::vector<Record>& records) {
+                if (records.empty())
+                    return;
+
+                Begin(type, (uint32)records.size());
+                Append(entities.data(), entities.size() * sizeof(uint32));
+                Align();
+                Append(records.data(), records.size() * sizeof(Record));
+                End();
+            }
+
+            bool Save(const Path& path, FileHeader header) {
+                header.SectionCount = (uint32)m_Sections.size();
+
+                const uint64 base = sizeof(FileHeader) + m_Sections.size() * sizeof(SectionHeader);
+                for (SectionHeader& section : m_Sections)
+                    section.Offset += base;
+
+                std::ofstream file(path, std::ios::out | std::ios::binary);
+                if (!file) {
+                    VANTA_CORE_ERROR("Failed to open file: '{}'", path);
+                    return false;
+                }
+
+                file.write((const char*)&header, sizeof(FileHeader));
+                file.write((const char*)m_Sections.data(), m_Sections.size() * sizeof(SectionHeader));
+                file.write((const char*)m_Body.data(), m_Body.size());
+                return (bool)file;
+            }
+
+        private:
+            std::vector<SectionHeader> m_Sections;
+            std::vector<uint8> m_Body;
+
+            void Begin(SectionType type, uint32 count) {
+                Align();
+                m_Sections.push_back({ type, count, m_Body.size(), 0 });
+            }
+
+            void End() {
+                SectionHeader& section = m_Sections.back();
+                section.Size = m_Body.size() - section.Offset;
+            }
+
+            void Append(const void* data, usize size) {
+                const uint8* bytes = (const uint8*)data;
+                m_Body.insert(m_Body.end(), bytes, bytes + size);
+            }
+
+            void Align() {
+                m_Body.resize((m_Body.size() + 7) & ~usize(7));
+            }
+        };
+
+        using EntityIndices = std::unordered_map<entt::entity, uint32>;
+
+        template<typename Component, typename Record, typename Func>
+        static void WriteSection(Writer& writer, SectionType type, Scene& scene, const EntityIndices& indices, Func&& convert) {
+            std::vector<uint32> entities;
+            std::vector<Record> records;
+            scene.View<Component>([&](entt::entity entity, Component& component) {
+                auto it = indices.find(entity);
+                if (it == indices.end())
+                    return;
+
+                entities.push_back(it->second);
+                records.push_back(convert(component));
+            });
+            writer.Write(type, entities, records);
+        }
+
+        template<typename Component>
+        static void GatherScriptFields(Scene& scene, Scripts::ScriptEngine& engine, bool native, const EntityIndices& indices,
+            StringTable& strings, std::vector<ScriptFieldRecord>& records)
+        {
+            scene.View<Component>([&](entt::entity entity, Component& component) {
+                auto it = indices.find(entity);
+                if (it == indices.end() || !engine.EntityClassExists(component.ClassName))
+                    return;
+
+                auto fieldInstances = engine.GetFieldInstances(Entity(entity, &scene));
+                if (!fieldInstances)
+                    return;
+
+                for (const auto& [name, instance] : fieldInstances->get()) {
+                    const usize size = GetFieldSize(instance->Field->Type);
+                    if (size == 0)
+                        continue;
+
+                    ScriptFieldRecord record = {};
+                    record.Entity = it->second;
+                    record.Native = native;
+                    record.Name = strings.Add(name);
+                    record.Type = (uint32)(Scripts::ScriptFieldType::Value)instance->Field->Type;
+                    memcpy(record.Value, instance->GetFieldData(), size);
+                    records.push_back(record);
+                }
+            });
+        }
+
+        struct Section {
+            const uint8* Data = nullptr;
+            uint32 Count = 0;
+            uint64 Size = 0;
+
+            operator bool() const { return Data != nullptr; }
+        };
+
+        // Records of a section, starting `offset` bytes in. Null if they don't fit in the section.
+        template<typename Record>
+        static const Record* GetRecords(const Section& section, usize offset) {
+            if (!section || section.Size < offset + (usize)section.Count * sizeof(Record))
+                return nullptr;
+            return (const Record*)(section.Data + offset);
+        }
+
+        static bool ReadStrings(const Section& section, std::vector<std::string_view>& strings) {
+            if (!section)
+                return true;
+
+            const usize offsetsSize = ((usize)section.Count + 1) * sizeof(uint32);
+            if (section.Size < offsetsSize)
+                return false;
+
+            const uint32* offsets = (const uint32*)section.Data;
+            const char* chars = (const char*)section.Data + offsetsSize;
+            const usize charCount = section.Size - offsetsSize;
+
+            strings.reserve(section.Count);
+            for (uint32 i = 0; i < section.Count; i++) {
+                if (offsets[i] > offsets[i + 1] || offsets[i + 1] > charCount)
+                    return false;
+                strings.emplace_back(chars + offsets[i], offsets[i + 1] - offsets[i]);
+            }
+            return true;
+        }
+
+        static std::string_view GetString(const std::vector<std::string_view>& strings, uint32 index) {
+            return index < strings.size() ? strings[index] : std::string_view();
+        }
+
+        // Call a function with every record of a component section, and the entity it belongs to.
+        template<typename Record, typename Func>
+        static bool ForEachRecord(const Section& section, const std::vector<entt::entity>& entities, Func&& func) {
+            if (!section)
+                return true;
+
+            const uint32* indices = GetRecords<uint32>(section, 0);
+            const Record* records = GetRecords<Record>(section, IndexColumnSize(section.Count));
+            if (!indices || !records)
+                return false;
+
+            for (uint32 i = 0; i < section.Count; i++) {
+                if (indices[i] >= entities.size())
+                    return false;
+                func(entities[indices[i]], records[i]);
+            }
+            return true;
+        }
+
+        // Add the components of a section to their entities, all at once.
+        template<typename Component, typename Record, typename Func>
+        static bool InsertSection(Scene& scene, const Section& section, const std::vector<entt::entity>& entities, Func&& convert) {
+            std::vector<entt::entity> targets;
+            std::vector<Component> components;
+            targets.reserve(section.Count);
+            components.reserve(section.Count);
+
+            bool valid = ForEachRecord<Record>(section, entities, [&](entt::entity entity, const Record& record) {
+                targets.push_back(entity);
+                convert(record, components.emplace_back());
+            });
+            if (!valid)
+                return false;
+
+            scene.InsertComponents<Component>(targets, components.begin());
+            return true;
+        }
+    }
+
+    BinarySceneSerializer::BinarySceneSerializer(const Path& filepath)
+        : m_Filepath(filepath) {}
+
+    bool BinarySceneSerializer::Serialize(const Ref<Scene>& scene) {
+        VANTA_PROFILE_FUNCTION();
+        using namespace BinaryScene;
+
+        StringTable strings;
+        EntityIndices indices;
+
+        std::vector<uint64> ids;
+        std::vector<uint32> names;
+        std::vector<TransformRecord> transforms;
+        scene->View<IDComponent, TransformComponent>([&](entt::entity entity, IDComponent& id, TransformComponent& tr) {
+            indices.emplace(entity, (uint32)ids.size());
+            ids.push_back(id.ID);
+            names.push_back(strings.Add(id.Name));
+            transforms.push_back({ tr.GetPosition(), tr.GetRotationRadians(), tr.GetScale() });
+        });
+
+        FileHeader header = {};
+        memcpy(header.Magic, MAGIC, sizeof(MAGIC));
+        header.Version = VERSION;
+        header.EntityCount = (uint32)ids.size();
+        header.ActiveCamera = NO_INDEX;
+        if (auto camera = scene->GetActiveCameraEntity()) {
+            auto it = indices.find(camera.GetHandle());
+            if (it != indices.end())
+                header.ActiveCamera = it->second;
+        }
+
+        Writer writer;
+        writer.Write(SectionType::IDs, ids);
+        writer.Write(SectionType::Names, names);
+        writer.Write(SectionType::Transforms, transforms);
+
+        WriteSection<CameraComponent, CameraRecord>(writer, SectionType::Cameras, *scene, indices, [](CameraComponent& component) {
+            const SceneCamera& camera = *component.Camera;
+            return CameraRecord{
+                (int32)camera.GetProjectionType(),
+                camera.GetPerspectiveFOV(),
+                camera.GetPerspectiveNearClip(),
+                camera.GetPerspectiveFarClip(),
+                camera.GetOrthographicSize(),
+                camera.GetOrthographicNearClip(),
+                camera.GetOrthographicFarClip(),
+                component.FixedAspectRatio,
+            };
+        });
+
+        WriteSection<SpriteComponent, SpriteRecord>(writer, SectionType::Sprites, *scene, indices, [&strings](SpriteComponent& component) {
+            uint32 texture = NO_INDEX;
+            if (component.Texture && !component.Texture->GetPath().empty())
+                texture = strings.Add(Project::GetAssetPathRelative(component.Texture->GetPath()).string());
+            return SpriteRecord{ texture, component.TilingFactor, component.Color };
+        });
+
+        WriteSection<CircleRendererComponent, CircleRendererRecord>(writer, SectionType::CircleRenderers, *scene, indices, [](CircleRendererComponent& component) {
+            return CircleRendererRecord{ component.Color, component.Thickness, component.Fade };
+        });
+
+        WriteSection<Rigidbody2DComponent, Rigidbody2DRecord>(writer, SectionType::Rigidbodies2D, *scene, indices, [](Rigidbody2DComponent& component) {
+            return Rigidbody2DRecord{ (int32)component.Type, component.FixedRotation };
+        });
+
+        WriteSection<BoxCollider2DComponent, BoxCollider2DRecord>(writer, SectionType::BoxColliders2D, *scene, indices, [](BoxCollider2DComponent& component) {
+            return BoxCollider2DRecord{ component.Size, component.Offset,
+                component.Density, component.Friction, component.Restitution, component.RollingResistance };
+        });
+
+        WriteSection<CircleCollider2DComponent, CircleCollider2DRecord>(writer, SectionType::CircleColliders2D, *scene, indices, [](CircleCollider2DComponent& component) {
+            return CircleCollider2DRecord{ component.Radius, component.Offset,
+                component.Density, component.Friction, component.Restitution, component.RollingResistance };
+        });
+
+        WriteSection<CSharpScriptComponent, ScriptRecord>(writer, SectionType::CSharpScripts, *scene, indices, [&strings](CSharpScriptComponent& component) {
+            return ScriptRecord{ strings.Add(component.ClassName) };
+        });
+
+        WriteSection<NativeScriptComponent, ScriptRecord>(writer, SectionType::NativeScripts, *scene, indices, [&strings](NativeScriptComponent& component) {
+            return ScriptRecord{ strings.Add(component.ClassName) };
+        });
+
+        std::vector<ScriptFieldRecord> fields;
+        GatherScriptFields<CSharpScriptComponent>(*scene, Scripts::CSharpScriptEngine::Get(), false, indices, strings, fields);
+        GatherScriptFields<NativeScriptComponent>(*scene, Scripts::NativeScriptEngine::Get(), true, indices, strings, fields);
+        if (!fields.empty())
+            writer.Write(SectionType::ScriptFields, fields);
+
+        // Written last, once every other section has added its strings
+        writer.Write(strings);
+
+        return writer.Save(m_Filepath, header);
+    }
+
+    bool BinarySceneSerializer::Deserialize(Ref<Scene>& scene) {
+        VANTA_PROFILE_FUNCTION();
+        using namespace BinaryScene;
+
+        IO::MappedFile file(m_Filepath);
+        if (!file || file.Size() < sizeof(FileHeader)) {
+            VANTA_CORE_ERROR("Failed to read binary scene: {}", m_Filepath);
+            return false;
+        }
+
+        const FileHeader& header = *(const FileHeader*)file.Data();
+        if (memcmp(header.Magic, MAGIC, sizeof(MAGIC)) != 0) {
+            VANTA_CORE_ERROR("Not a binary scene: {}", m_Filepath);
+            return false;
+        }
+        if (header.Version != VERSION) {
+            VANTA_CORE_ERROR("Unsupported binary scene version {} (expected {}): {}", header.Version, VERSION, m_Filepath);
+            return false;
+        }
+
+        auto corrupt = [this]() {
+            VANTA_CORE_ERROR("Corrupt binary scene: {}", m_Filepath);
+            return false;
+        };
+
+        if (file.Size() < sizeof(FileHeader) + (usize)header.SectionCount * sizeof(SectionHeader))
+            return corrupt();
+
+        std::array<Section, (usize)SectionType::Count> sections;
+        const SectionHeader* table = (const SectionHeader*)(file.Data() + sizeof(FileHeader));
+        for (uint32 i = 0; i < header.SectionCount; i++) {
+            const SectionHeader& section = table[i];
+            if (section.Offset > file.Size() || section.Size > file.Size() - section.Offset)
+                return corrupt();
+
+            if ((uint32)section.Type < (uint32)SectionType::Count)
+                sections[(usize)section.Type] = { file.Data() + section.Offset, section.Count, section.Size };
+        }
+        auto getSection = [&sections](SectionType type) -> const Section& { return sections[(usize)type]; };
+
+        std::vector<std::string_view> strings;
+        if (!ReadStrings(getSection(SectionType::Strings), strings))
+            return corrupt();
+
+        // Entities, with their IDs and transforms
+        const uint32 entityCount = header.EntityCount;
+        const uint64* ids = GetRecords<uint64>(getSection(SectionType::IDs), 0);
+        const uint32* names = GetRecords<uint32>(getSection(SectionType::Names), 0);
+        const TransformRecord* transforms = GetRecords<TransformRecord>(getSection(SectionType::Transforms), 0);
+        if (!ids || !names || !transforms
+            || getSection(SectionType::IDs).Count != entityCount
+            || getSection(SectionType::Names).Count != entityCount
+            || getSection(SectionType::Transforms).Count != entityCount)
+        {
+            return corrupt();
+        }
+
+        std::vector<IDComponent> idComponents;
+        std::vector<TransformComponent> transformComponents(entityCount);
+        idComponents.reserve(entityCount);
+        for (uint32 i = 0; i < entityCount; i++) {
+            idComponents.emplace_back(std::string(GetString(strings, names[i])), UUID(ids[i]));
+            transformComponents[i].SetTransformRad(transforms[i].Position, transforms[i].Rotation, transforms[i].Scale);
+        }
+
+        std::vector<entt::entity> entities;
+        scene->CreateEntities(idComponents, transformComponents, entities);
+
+        // Cameras are added one by one, so the scene can set them up
+        bool valid = ForEachRecord<CameraRecord>(getSection(SectionType::Cameras), entities, [&](entt::entity entity, const CameraRecord& record) {
+            auto& cc = scene->AddComponent<CameraComponent>(entity);
+            cc.Camera->SetProjectionType((SceneCamera::Projection)record.ProjectionType);
+
+            cc.Camera->SetPerspectiveFOV(record.PerspectiveFOV);
+            cc.Camera->SetPerspectiveNearClip(record.PerspectiveNear);
+            cc.Camera->SetPerspectiveFarClip(record.PerspectiveFar);
+
+            cc.Camera->SetOrthographicSize(record.OrthographicSize);
+            cc.Camera->SetOrthographicNearClip(record.OrthographicNear);
+            cc.Camera->SetOrthographicFarClip(record.OrthographicFar);
+
+            cc.FixedAspectRatio = record.FixedAspectRatio;
+        });
+
+        valid = valid && InsertSection<SpriteComponent, SpriteRecord>(*scene, getSection(SectionType::Sprites), entities,
+            [&strings](const SpriteRecord& record, SpriteComponent& sp) {
+                if (record.Texture != NO_INDEX)
+                    sp.Texture = AssetManager::LoadTexture(Project::GetAssetPath(Path(GetString(strings, record.Texture))));
+                sp.TilingFactor = record.TilingFactor;
+                sp.Color = record.Color;
+            });
+
+        valid = valid && InsertSection<CircleRendererComponent, CircleRendererRecord>(*scene, getSection(SectionType::CircleRenderers), entities,
+            [](const CircleRendererRecord& record, CircleRendererComponent& cr) {
+                cr.Color = record.Color;
+                cr.Thickness = record.Thickness;
+                cr.Fade = record.Fade;
+            });
+
+        valid = valid && InsertSection<Rigidbody2DComponent, Rigidbody2DRecord>(*scene, getSection(SectionType::Rigidbodies2D), entities,
+            [](const Rigidbody2DRecord& record, Rigidbody2DComponent& rb) {
+                rb.Type = (Rigidbody2DComponent::BodyType)record.BodyType;
+                rb.FixedRotation = record.FixedRotation;
+            });
+
+        valid = valid && InsertSection<BoxCollider2DComponent, BoxCollider2DRecord>(*scene, getSection(SectionType::BoxColliders2D), entities,
+            [](const BoxCollider2DRecord& record, BoxCollider2DComponent& bc) {
+                bc.Size = record.Size;
+                bc.Offset = record.Offset;
+                bc.Density = record.Density;
+                bc.Friction = record.Friction;
+                bc.Restitution = record.Restitution;
+                bc.RollingResistance = record.RollingResistance;
+            });
+
+        valid = valid && InsertSection<CircleCollider2DComponent, CircleCollider2DRecord>(*scene, getSection(SectionType::CircleColliders2D), entities,
+            [](const CircleCollider2DRecord& record, CircleCollider2DComponent& cc) {
+                cc.Radius = record.Radius;
+                cc.Offset = record.Offset;
+                cc.Density = record.Density;
+                cc.Friction = record.Friction;
+                cc.Restitution = record.Restitution;
+                cc.RollingResistance = record.RollingResistance;
+            });
+
+        valid = valid && InsertSection<CSharpScriptComponent, ScriptRecord>(*scene, getSection(SectionType::CSharpScripts), entities,
+            [&strings](const ScriptRecord& record, CSharpScriptComponent& sc) {
+                sc.ClassName = GetString(strings, record.Class);
+                if (!Scripts::CSharpScriptEngine::Get().EntityClassExists(sc.ClassName))
+                    VANTA_CORE_WARN("Class no longer exists: {}", sc.ClassName);
+            });
+
+        valid = valid && InsertSection<NativeScriptComponent, ScriptRecord>(*scene, getSection(SectionType::NativeScripts), entities,
+            [&strings](const ScriptRecord& record, NativeScriptComponent& sc) {
+                sc.ClassName = GetString(strings, record.Class);
+                if (!Scripts::NativeScriptEngine::Get().EntityClassExists(sc.ClassName))
+                    VANTA_CORE_WARN("Class no longer exists: {}", sc.ClassName);
+            });
+
+        if (!valid)
+            return corrupt();
+
+        // Script fields
+        const Section& fieldSection = getSection(SectionType::ScriptFields);
+        if (fieldSection) {
+            const ScriptFieldRecord* fields = GetRecords<ScriptFieldRecord>(fieldSection, 0);
+            if (!fields)
+                return corrupt();
+
+            for (uint32 i = 0; i < fieldSection.Count; i++) {
+                const ScriptFieldRecord& record = fields[i];
+                if (record.Entity >= entities.size())
+                    return corrupt();
+
+                Entity entity(entities[record.Entity], scene.get());
+                Scripts::ScriptEngine& engine = record.Native
+                    ? (Scripts::ScriptEngine&)Scripts::NativeScriptEngine::Get()
+                    : (Scripts::ScriptEngine&)Scripts::CSharpScriptEngine::Get();
+
+                const ScriptComponent* sc = record.Native
+                    ? (const ScriptComponent*)entity.TryGetComponent<NativeScriptComponent>()
+                    : (const ScriptComponent*)entity.TryGetComponent<CSharpScriptComponent>();
+                if (!sc || !engine.EntityClassExists(sc->ClassName))
+                    continue;
+
+                const std::string fieldName(GetString(strings, record.Name));
+                const auto& classFields = engine.GetEntityClass(sc->ClassName)->GetFields();
+                const auto& it = classFields.find(fieldName);
+                if (it == classFields.end()) {
+                    VANTA_CORE_WARN("Field no longer exists: {}", fieldName);
+                    continue;
+                }
+
+                const auto& field = it->second;
+                const Scripts::ScriptFieldType type = (Scripts::ScriptFieldType::Value)record.Type;
+                if (field->Type != type) {
+                    VANTA_CORE_WARN("Field changed type: {}", fieldName);
+                    continue;
+                }
+
+#define READ_SCRIPT_FIELD(fieldType, type) \
+    case Scripts::ScriptFieldType::fieldType: { \
+        type value; \
+        memcpy(&value, record.Value, sizeof(type)); \
+        engine.SetFieldInstance(entity, NewBox<Scripts::ScriptFieldBuffer<type>>(field, value)); \
+        break; \
+    }
+                switch (type) {
+                    READ_SCRIPT_FIELD(Bool, bool);
+                    READ_SCRIPT_FIELD(Char, char);
+
+                    READ_SCRIPT_FIELD(Int8, int8);
+                    READ_SCRIPT_FIELD(Int16, int16);
+                    READ_SCRIPT_FIELD(Int32, int32);
+                    READ_SCRIPT_FIELD(Int64, int64);
+
+                    READ_SCRIPT_FIELD(UInt8, uint8);
+                    READ_SCRIPT_FIELD(UInt16, uint16);
+                    READ_SCRIPT_FIELD(UInt32, uint32);
+                    READ_SCRIPT_FIELD(UInt64, uint64);
+
+                    READ_SCRIPT_FIELD(Float, float);
+                    READ_SCRIPT_FIELD(Double, double);
+
+                    READ_SCRIPT_FIELD(Vector2, glm::vec2);
+                    READ_SCRIPT_FIELD(Vector3, glm::vec3);
+                    READ_SCRIPT_FIELD(Vector4, glm::vec4);
+
+                    READ_SCRIPT_FIELD(Entity, UUID);
+                }
+#undef READ_SCRIPT_FIELD
+            }
+        }
+
+        if (header.ActiveCamera < entities.size())
+            scene->SetActiveCameraEntity(entities[header.ActiveCamera]);
+
+        return true;
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Vanta/Scene/Scene.hpp"
+
+namespace Vanta {
+
+    /// <summary>
+    /// Binary form of a scene, for loading scenes quickly at runtime.
+    ///
+    /// The file starts with a versioned header and a table of sections, one per component type.
+    /// Sections are columnar: each holds the indices of the entities that have the component,
+    /// followed by the component data packed back to back.
+    /// Files are read through a memory mapping and components are added in bulk,
+    /// so loading does little more than copy every section into the registry.
+    ///
+    /// Text scenes stay the editable source; the editor converts between the two.
+    /// Files of a different version are rejected, and have to be converted again.
+    /// </summary>
+    class BinarySceneSerializer {
+    public:
+        static constexpr uint32 VERSION = 1;
+        static constexpr const char* EXTENSION = ".vntb";
+
+        BinarySceneSerializer(const Path& filepath);
+
+        bool Serialize(const Ref<Scene>& scene);
+        bool Deserialize(Ref<Scene>& scene);
+
+        /// <summary>
+        /// Whether a path names a binary scene.
+        /// </summary>
+        static bool IsBinary(const Path& path) { return path.extension() == EXTENSION; }
+
+        /// <summary>
+        /// Path of the binary form of a scene.
+        /// </summary>
+        static Path GetBinaryPath(const Path& path) { return Path(path).replace_extension(EXTENSION); }
+
+    private:
+        Path m_Filepath;
+    };
+}
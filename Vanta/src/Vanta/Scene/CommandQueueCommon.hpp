@@ -3,6 +3,8 @@
 #include <entt/entt.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 
 namespace Vanta {
 
@@ -25,37 +27,132 @@ namespace Vanta {
         Editor,
     };
 
+    inline constexpr usize COMMAND_PHASE_COUNT = 3;
+
+    /// Identifies how a queue turns the commands of a phase into component writes.
+    enum class CommandApplyMode : uint8_t {
+        InOrder,   ///< Every command is written in turn
+        Coalesced, ///< Commands are merged per entity first, so every entity is written once
+    };
+
+    inline usize PhaseIndex(CommandPhase phase) { return static_cast<usize>(phase); }
+
     /// Base metadata carried by every scene command.
     struct SceneCommandMeta {
         entt::entity  Entity = entt::null;
         CommandSource Source = CommandSource::NativeScript;
         CommandPhase  Phase  = CommandPhase::Script;
+        /// Order the command was staged in, stamped by the queue; later sequences win.
+        /// Only matters when several threads write the same entity, since a thread's own commands keep their order.
+        uint32_t      Sequence = 0;
     };
 
     struct CommandQueueDiagnostics {
         uint32_t Enqueued = 0;  ///< Commands submitted this frame
         uint32_t Applied  = 0;  ///< Commands successfully written to components
         uint32_t Dropped  = 0;  ///< Commands rejected (missing entity / component)
+        uint32_t Coalesced = 0; ///< Commands merged into another command's write
 
-        void Reset() { Enqueued = Applied = Dropped = 0; }
+        void Reset() { Enqueued = Applied = Dropped = Coalesced = 0; }
     };
 
+    /// Number of threads that may enqueue into a command queue without locking.
+    /// Bounded by the width of the per-queue active producer mask, which also covers the shared slot.
+    inline constexpr usize MAX_COMMAND_PRODUCERS = 63;
+
+    /// Slot used by threads that found every producer slot taken.
+    /// Its staging buffer is shared, so writing to it takes a lock.
+    inline constexpr usize SHARED_COMMAND_PRODUCER = MAX_COMMAND_PRODUCERS;
+
+    namespace detail {
+
+        inline std::atomic<uint64_t> s_UsedCommandProducers = 0;
+        inline std::atomic<uint64_t> s_NextCommandProducerID = 0;
+
+        // Holds a producer slot for the lifetime of a thread, and gives it back when the thread exits
+        struct CommandProducerLease {
+            usize Slot = SHARED_COMMAND_PRODUCER;
+
+            CommandProducerLease() {
+                constexpr uint64_t allSlots = (uint64_t(1) << MAX_COMMAND_PRODUCERS) - 1;
+                uint64_t used = s_UsedCommandProducers.load(std::memory_order_relaxed);
+                while ((used & allSlots) != allSlots) {
+                    const usize free = std::countr_one(used);
+                    if (s_UsedCommandProducers.compare_exchange_weak(used, used | (uint64_t(1) << free), std::memory_order_acquire)) {
+                        Slot = free;
+                        return;
+                    }
+                }
+                VANTA_CORE_WARN("Out of command producer slots; thread falls back to the shared staging buffer");
+            }
+
+            ~CommandProducerLease() {
+                if (Slot != SHARED_COMMAND_PRODUCER)
+                    s_UsedCommandProducers.fetch_and(~(uint64_t(1) << Slot), std::memory_order_release);
+            }
+        };
+    }
+
+    /// <summary>
+    /// Index of the calling thread's command staging buffer; shared by all command queues.
+    /// Assigned on first use and given back when the thread exits, so later threads reuse it.
+    /// Returns SHARED_COMMAND_PRODUCER while every slot is held by a live thread.
+    /// </summary>
+    inline usize CommandProducerSlot() {
+        thread_local detail::CommandProducerLease lease;
+        return lease.Slot;
+    }
+
+    /// <summary>
+    /// Unique ID of the calling thread as a command producer.
+    /// Tells apart threads that held the same slot one after another.
+    /// </summary>
+    inline uint64_t CommandProducerID() {
+        thread_local uint64_t id = detail::s_NextCommandProducerID.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    /// <summary>
+    /// Invoke a function with the slot index of every producer set in an active producer mask,
+    /// in ascending slot order.
+    /// </summary>
+    template<typename Fn>
+    void ForEachCommandProducer(uint64_t mask, Fn&& fn) {
+        for (usize slot = 0; mask != 0; ++slot, mask >>= 1) {
+            if (mask & 1)
+                fn(slot);
+        }
+    }
+
+    /// <summary>
+    /// Move staged commands to the end of a queue.
+    /// Staged storage is swapped in when the queue is empty, so capacity keeps being reused.
+    /// </summary>
     template<typename CmdVector>
-    usize PendingCountForPhase(const CmdVector& vec, CommandPhase phase) {
-        usize n = 0;
-        for (const auto& cmd : vec) {
-            if (cmd.Phase == phase)
-                ++n;
+    void MergeStagedCommands(CmdVector& vec, CmdVector& staged) {
+        if (vec.empty()) {
+            std::swap(vec, staged);
+        }
+        else {
+            vec.insert(vec.end(), staged.begin(), staged.end());
+            staged.clear();
         }
-        return n;
     }
 
+    /// <summary>
+    /// Stable sort commands from a given index onward by target entity, then source, then sequence.
+    /// Makes the result of merging several producers independent of which thread produced what,
+    /// while keeping the per-entity order of every producer.
+    /// </summary>
     template<typename CmdVector>
-    void EraseCommandsForPhase(CmdVector& vec, CommandPhase phase) {
-        vec.erase(
-            std::remove_if(vec.begin(), vec.end(),
-                [phase](const auto& cmd) { return cmd.Phase == phase; }),
-            vec.end());
+    void SortCommandsByEntity(CmdVector& vec, usize first) {
+        std::stable_sort(vec.begin() + first, vec.end(), [](const auto& a, const auto& b) {
+            if (a.Entity != b.Entity)
+                return entt::to_integral(a.Entity) < entt::to_integral(b.Entity);
+            if (a.Source != b.Source)
+                return a.Source < b.Source;
+            return a.Sequence < b.Sequence;
+        });
     }
 
 } // namespace Vanta
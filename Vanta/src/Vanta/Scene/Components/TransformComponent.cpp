@@ -17,6 +17,7 @@ namespace Vanta {
     void TransformComponent::SetTransform(const glm::mat4& transform) {
         Transform = transform;
         Math::Decompose(Transform, Position, Rotation, Scale);
+        Version++;
     }
 
     void TransformComponent::SetTransformRad(
@@ -28,6 +29,7 @@ namespace Vanta {
         Rotation = radians;
         Scale = scale;
         DirtyTransform = true;
+        Version++;
     }
 
     void TransformComponent::SetTransformDeg(
@@ -41,6 +43,7 @@ namespace Vanta {
     void TransformComponent::SetPosition(const glm::vec3& position) {
         Position = position;
         DirtyTransform = true;
+        Version++;
     }
 
     void TransformComponent::SetRotationDeg(const glm::vec3& degrees) {
@@ -50,11 +53,13 @@ namespace Vanta {
     void TransformComponent::SetRotationRad(const glm::vec3& radians) {
         Rotation = radians;
         DirtyTransform = true;
+        Version++;
     }
 
     void TransformComponent::SetScale(const glm::vec3& scale) {
         Scale = scale;
         DirtyTransform = true;
+        Version++;
     }
 
     void TransformComponent::Recalculate() {
@@ -31,6 +31,11 @@ namespace Vanta {
 
         const glm::vec3& GetScale() const { return Scale; }
 
+        /// <summary>
+        /// Incremented by every setter, so anything derived from the transform can tell it's stale.
+        /// </summary>
+        uint32 GetVersion() const { return Version; }
+
     private:
         glm::mat4 Transform = glm::mat4(1.f);
 
@@ -38,6 +43,7 @@ namespace Vanta {
         glm::vec3 Rotation = { 0.f, 0.f, 0.f }; // Rotation in radians
         glm::vec3 Scale = { 1.f, 1.f, 1.f };    // Scale
 
+        uint32 Version = 0;
         bool DirtyTransform = false;
 
         void Recalculate();
@@ -22,120 +22,161 @@ namespace Vanta {
     };
 
     /// <summary>
-    /// Synchronization object for coordinating fiber-based processing.
-    /// To be used in conjunction with `ParallelView`, which handles work dispatch to fibers.
+    /// Completion handle for jobs started by `ParallelView`.
+    /// Also owns the state those jobs work on, in storage that is reused from one `Wait` to the next.
     /// </summary>
     class ParallelBarrier {
     public:
+        ParallelBarrier() = default;
+        ~ParallelBarrier() { Wait(); }
+
+        ParallelBarrier(const ParallelBarrier&) = delete;
+        ParallelBarrier& operator=(const ParallelBarrier&) = delete;
+
+        JobCounter& GetCounter() { return m_Counter; }
+
         /// <summary>
-        /// Setup function for synchronizer thread.
+        /// Construct some state in the barrier's own storage, destroyed by the next `Wait`.
+        /// The storage is reused after every `Wait`, so it stops allocating once it fits a frame's jobs.
         /// </summary>
-        /// <param name="jobCount">Number of jobs that will be executed</param>
-        void StartFibers(usize jobCount) {
-            Fibers::Begin(jobCount);
-            m_Barrier = new fibers::barrier(jobCount + 1); // + 1 for this thread
+        template<typename T, typename... Args>
+        T& Emplace(Args&&... args) {
+            static_assert(sizeof(T) <= BLOCK_SIZE, "State doesn't fit in a barrier block!");
+            static_assert(alignof(T) <= alignof(Block), "State is over-aligned for a barrier block!");
+
+            T* state = new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+            if constexpr (!std::is_trivially_destructible_v<T>)
+                m_Destructors.push_back({ state, [](void* ptr) { static_cast<T*>(ptr)->~T(); } });
+            return *state;
         }
 
         /// <summary>
-        /// Wait function for synchronizer thread.
-        /// Waits for all running jobs to be complete.
+        /// Wait for all running jobs to be complete.
         /// </summary>
         void Wait() {
-            if (m_Barrier != nullptr) {
-                m_Barrier->wait();
-                Fibers::End();
-                delete m_Barrier;
-                m_Barrier = nullptr;
+            m_Counter.Wait();
+
+            for (auto it = m_Destructors.rbegin(); it != m_Destructors.rend(); ++it)
+                it->Destroy(it->State);
+            m_Destructors.clear();
+            m_Block = 0;
+            m_Offset = 0;
+        }
+
+    private:
+        static constexpr usize BLOCK_SIZE = 4096;
+
+        struct alignas(std::max_align_t) Block {
+            std::byte Data[BLOCK_SIZE];
+        };
+
+        struct Destructor {
+            void* State;
+            void (*Destroy)(void*);
+        };
+
+        JobCounter m_Counter;
+
+        std::vector<Box<Block>> m_Blocks;
+        std::vector<Destructor> m_Destructors;
+        usize m_Block = 0;  // Block being filled
+        usize m_Offset = 0; // First free byte in it
+
+        void* Allocate(usize size, usize align) {
+            usize offset = (m_Offset + align - 1) & ~(align - 1);
+            if (m_Block < m_Blocks.size() && offset + size > BLOCK_SIZE) {
+                m_Block++;
+                offset = 0;
             }
+            if (m_Block == m_Blocks.size())
+                m_Blocks.push_back(NewBox<Block>());
+
+            m_Offset = offset + size;
+            return m_Blocks[m_Block]->Data + offset;
+        }
+    };
+
+    namespace detail {
+
+        /// Fewest entities handed to a worker at once; below this, dispatch costs more than it saves.
+        inline constexpr usize PARALLEL_MIN_CHUNK_SIZE = 256;
+        /// Chunks per worker; more than one lets fast workers pick up after slow ones.
+        inline constexpr usize PARALLEL_CHUNKS_PER_WORKER = 4;
+
+        inline usize ParallelChunkSize(usize count) {
+            const usize workers = std::max<usize>(Fibers::THREAD_COUNT, 1);
+            return std::max(count / (workers * PARALLEL_CHUNKS_PER_WORKER), PARALLEL_MIN_CHUNK_SIZE);
         }
 
         /// <summary>
-        /// Wait function for a fiber instance.
-        /// Waits for all running jobs to be complete.
+        /// Invoke a function on the entities at [begin, end) of a view's leading storage.
+        /// Entities missing any of the other components are skipped.
         /// </summary>
-        void WaitFiber() {
-            if (m_Barrier != nullptr)
-                m_Barrier->wait();
+        template<typename View, typename Func>
+        void ProcessViewRange(View& view, Func& func, usize begin, usize end) {
+            const auto& handle = *view.handle();
+            for (usize i = begin; i < end; i++) {
+                const auto entity = handle[i];
+                if (!view.contains(entity))
+                    continue;
+
+                std::apply(func, std::tuple_cat(std::make_tuple(entity), view.get(entity)));
+            }
         }
-
-    private:
-        fibers::barrier* m_Barrier = nullptr;
-    };
+    }
 
     /// <summary>
     /// Job dispatcher that iterates over a collection of entities in parallel,
     /// on the engine's fiber pool.
+    /// The view's leading storage is split into index ranges, sized from the entity count and the
+    /// number of worker threads. At most `Fibers::THREAD_COUNT` jobs are started, and each keeps
+    /// taking chunks until none are left.
     /// Makes use of `ParallelBarrier` for synchronizing with the caller thread.
+    /// The function is copied, and may still be running after this returns.
     /// </summary>
-    template<typename... Components, typename Registry, typename Func> requires (sizeof...(Components) > 1) // View has `size_hint()` for > 1 component
+    template<typename... Components, typename Registry, typename Func>
     void ParallelView(ParallelBarrier& barrier, Registry& registry, Func&& func) {
-        // Number of entities each fiber will process
-        static constexpr usize CHUNK_SIZE = 16;
+        using ViewType = decltype(registry.template View<Components...>());
+        using FuncType = std::decay_t<Func>;
 
-        registry.template ViewIter<Components...>([&](auto view, auto beg, auto end) {
-            if (beg == end)
-                return;
-
-            // Divide processable entity count by chunk size
-            usize jobCount = (usize)std::ceil((float)view.size_hint() / CHUNK_SIZE);
-
-            if (jobCount > 1) {
-                barrier.StartFibers(jobCount);
-
-                for (usize i = 0; i < jobCount; i++) {
-                    // Spawn a fiber to work on every CHUNK_SIZE of entities
-                    Fibers::Spawn([&func](auto* barrier, auto beg, auto end) {
-                        for (usize i = 0; i < CHUNK_SIZE && beg != end; ++i, ++beg) {
-                            std::apply(func, *beg);
-                        }
-                        barrier->WaitFiber();
-                    }, &barrier, beg, end);
-
-                    // Move entity iterator forward by CHUNK_SIZE
-                    for (usize j = 0; j < CHUNK_SIZE && beg != end; ++j)
-                        ++beg;
-                }
-            }
-            else {
-                // If there's only a single chunk of entities,
-                // process them right now
-                for (; beg != end; ++beg) {
-                    std::apply(func, *beg);
-                }
-            }
-        });
-    };
+        ViewType view = registry.template View<Components...>();
+        if (!view.handle())
+            return;
 
-    template<typename... Components, typename Registry, typename Func> requires (sizeof...(Components) == 1) // View has `size()` for 1 component
-    void ParallelView(ParallelBarrier& barrier, Registry& registry, Func&& func) {
-        static constexpr usize CHUNK_SIZE = 16;
+        const usize count = view.handle()->size();
+        const usize chunkSize = detail::ParallelChunkSize(count);
+        const usize chunkCount = (count + chunkSize - 1) / chunkSize;
 
-        registry.template ViewIter<Components...>([&](auto view, auto beg, auto end) {
-            if (beg == end)
-                return;
+        if (chunkCount <= 1) {
+            // Not enough entities to be worth dispatching, process them right now
+            detail::ProcessViewRange(view, func, 0, count);
+            return;
+        }
 
-            usize jobCount = (usize)std::ceil((float)view.size() / CHUNK_SIZE);
+        struct Work {
+            ViewType View;
+            FuncType Func;
+            usize Count;
+            usize ChunkSize;
+            std::atomic<usize> NextChunk = 0;
 
-            if (jobCount > 1) {
-                barrier.StartFibers(jobCount);
+            Work(ViewType view, FuncType func, usize count, usize chunkSize)
+                : View(view), Func(std::move(func)), Count(count), ChunkSize(chunkSize) {}
 
-                for (usize i = 0; i < jobCount; i++) {
-                    Fibers::Spawn([func](auto* barrier, auto beg, auto end) {
-                        for (usize i = 0; i < CHUNK_SIZE && beg != end; ++i, ++beg) {
-                            std::apply(func, *beg);
-                        }
-                        barrier->WaitFiber();
-                    }, &barrier, beg, end);
+            void operator()(usize) {
+                for (;;) {
+                    const usize begin = NextChunk.fetch_add(1, std::memory_order_relaxed) * ChunkSize;
+                    if (begin >= Count)
+                        break;
 
-                    for (usize j = 0; j < CHUNK_SIZE && beg != end; ++j)
-                        ++beg;
+                    detail::ProcessViewRange(View, Func, begin, std::min(Count, begin + ChunkSize));
                 }
             }
-            else {
-                for (; beg != end; ++beg) {
-                    std::apply(func, *beg);
-                }
-            }
-        });
-    };
+        };
+
+        auto& work = barrier.Emplace<Work>(view, FuncType(std::forward<Func>(func)), count, chunkSize);
+        const usize jobCount = std::min<usize>(std::max<usize>(Fibers::THREAD_COUNT, 1), chunkCount);
+
+        Fibers::Dispatch(barrier.GetCounter(), jobCount, work);
+    }
 }
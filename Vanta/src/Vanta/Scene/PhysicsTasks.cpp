@@ -0,0 +1,73 @@
+#include "vantapch.hpp"
+#include "Vanta/Scene/PhysicsTasks.hpp"
+
+#include <box2d/box2d.h>
+
+namespace Vanta {
+
+    PhysicsTasks::PhysicsTasks(uint workerCount) {
+        // Counting the serial worker, Box2D starts as many solver tasks as there are fiber threads
+        const uint maxWorkers = std::clamp<uint>(std::max<uint>(Fibers::THREAD_COUNT, 2) - 1, 1, MAX_WORKERS);
+        if (workerCount == 0)
+            workerCount = maxWorkers;
+        m_WorkerCount = std::clamp<uint>(workerCount, 1, maxWorkers);
+
+        m_FreeTasks.reserve(MAX_TASKS);
+        for (usize i = MAX_TASKS; i > 0; i--)
+            m_FreeTasks.push_back(&m_Tasks[i - 1]);
+    }
+
+    void PhysicsTasks::Configure(b2WorldDef& worldDef) {
+        worldDef.workerCount = (int)m_WorkerCount + 1;
+        worldDef.userTaskContext = this;
+
+        worldDef.enqueueTask = [](b2TaskCallback* task, int itemCount, int minRange, void* taskContext, void* userContext) -> void* {
+            return static_cast<PhysicsTasks*>(userContext)->Enqueue(task, itemCount, minRange, taskContext);
+        };
+        worldDef.finishTask = [](void* userTask, void* userContext) {
+            static_cast<PhysicsTasks*>(userContext)->Finish(userTask);
+        };
+    }
+
+    void PhysicsTasks::Reset() {
+        VANTA_CORE_ASSERT(m_FreeTasks.size() == MAX_TASKS, "Physics task was never finished!");
+    }
+
+    void* PhysicsTasks::Enqueue(TaskFunction function, int itemCount, int minRange, void* context) {
+        const int rangeSize = std::max(minRange, 1);
+        const uint jobCount = (uint)std::min<int>((int)m_WorkerCount, (itemCount + rangeSize - 1) / rangeSize);
+
+        // Returning null tells Box2D the work was done serially, and there is nothing to finish.
+        // The serial worker's index isn't used by any job, so tasks still in flight keep theirs to themselves.
+        if (m_FreeTasks.empty()) {
+            VANTA_CORE_WARN("Physics task pool exhausted, running task serially");
+            function(0, itemCount, m_WorkerCount, context);
+            return nullptr;
+        }
+
+        // Single item tasks still get dispatched; the solver starts one per worker, and they must run side by side
+        Task& task = *m_FreeTasks.back();
+        m_FreeTasks.pop_back();
+        task.Function = function;
+        task.Context = context;
+        task.ItemCount = itemCount;
+        task.JobCount = std::max<uint>(jobCount, 1);
+
+        Fibers::Dispatch(task.Counter, task.JobCount, task);
+        return &task;
+    }
+
+    void PhysicsTasks::Finish(void* task) {
+        // Runs queued jobs while waiting, rather than spinning on the stepping thread
+        Task* finished = static_cast<Task*>(task);
+        finished->Counter.Wait();
+        m_FreeTasks.push_back(finished);
+    }
+
+    void PhysicsTasks::Task::operator()(usize index) const {
+        // Job index doubles as the worker index, it's unique among the jobs of a task
+        const int begin = (int)((int64_t)ItemCount * index / JobCount);
+        const int end = (int)((int64_t)ItemCount * (index + 1) / JobCount);
+        Function(begin, end, (uint32_t)index, Context);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+struct b2WorldDef;
+
+namespace Vanta {
+
+    /// <summary>
+    /// Task system handed to Box2D, running the physics solver's parallel work on the engine's fiber pool.
+    /// Box2D splits its work into parallel-for tasks; every task is dispatched as up to `workerCount` jobs,
+    /// each given a disjoint item range and its job index as Box2D's worker index.
+    /// Box2D is told about one more worker than that, whose index is kept for tasks run serially
+    /// when the task pool runs out, so they never share scratch data with a job still in flight.
+    ///
+    /// Box2D's solver runs one task per worker, and those spin until the whole solver stage is done.
+    /// They're only kept from waiting on each other by fitting on the fiber threads all at once,
+    /// so there are never more workers than fiber threads.
+    /// Task records are recycled once finished, and checked with `Reset` after every world step.
+    /// </summary>
+    class PhysicsTasks {
+    public:
+        using TaskFunction = void(*)(int startIndex, int endIndex, uint32_t workerIndex, void* context);
+
+        /// Most tasks Box2D may have in flight during a single world step.
+        static constexpr usize MAX_TASKS = 256;
+        /// Most workers Box2D supports, less the one kept for serial tasks.
+        static constexpr uint MAX_WORKERS = 63;
+
+        /// <summary>
+        /// Create a task system for a given number of workers.
+        /// A worker count of 0 uses every fiber thread.
+        /// </summary>
+        explicit PhysicsTasks(uint workerCount = 0);
+
+        PhysicsTasks(const PhysicsTasks&) = delete;
+        PhysicsTasks& operator=(const PhysicsTasks&) = delete;
+
+        uint GetWorkerCount() const { return m_WorkerCount; }
+
+        /// <summary>
+        /// Point a world definition at this task system.
+        /// The task system must outlive the world.
+        /// </summary>
+        void Configure(b2WorldDef& worldDef);
+
+        /// <summary>
+        /// Check that every task of the last world step was finished.
+        /// </summary>
+        void Reset();
+
+    private:
+        struct Task {
+            TaskFunction Function = nullptr;
+            void* Context = nullptr;
+            int ItemCount = 0;
+            uint JobCount = 0;
+            JobCounter Counter;
+
+            void operator()(usize index) const;
+        };
+
+        // Box2D enqueues and finishes tasks from the thread stepping the world, so the pool isn't locked
+        std::array<Task, MAX_TASKS> m_Tasks;
+        std::vector<Task*> m_FreeTasks;
+        uint m_WorkerCount = 1;
+
+        void* Enqueue(TaskFunction function, int itemCount, int minRange, void* context);
+        void Finish(void* task);
+    };
+}
@@ -39,18 +39,51 @@ namespace Vanta {
                 return b2_staticBody;
             }
         }
+
+        // Bodies carry their entity as user data, so physics events can be mapped back to the scene
+        static void* EntityToBodyUserData(entt::entity entity) {
+            return reinterpret_cast<void*>(static_cast<uintptr_t>(entt::to_integral(entity)));
+        }
+
+        static entt::entity BodyUserDataToEntity(void* userData) {
+            return static_cast<entt::entity>(static_cast<entt::id_type>(reinterpret_cast<uintptr_t>(userData)));
+        }
+
+        // Shader part of render sort keys
+        enum RenderShader : uint32 {
+            QuadShader = 0,
+            CircleShader = 1,
+        };
+
+        // Render queue payloads are either a circle index, or a sprite job and its index in that job
+        static constexpr uint64 RENDER_PAYLOAD_CIRCLE = 1ull << 63;
+
+        static float RenderDepth(const glm::mat4& viewProjection, const glm::mat4& transform) {
+            const glm::vec4 clip = viewProjection * transform[3];
+            return (clip.w != 0.f) ? clip.z / clip.w : clip.z;
+        }
+
+        static bool IsOpaque(const SpriteComponent& sprite) {
+            // Textures with partially transparent pixels blend, so they're drawn in depth order too
+            return sprite.Color.a >= 1.f && (!sprite.Texture || sprite.Texture->IsOpaque());
+        }
     }
 
     Scene::Scene()
-        : m_ViewportSize(Engine::Get().GetWindow().GetWidth(), Engine::Get().GetWindow().GetHeight()) {}
+        : m_ViewportSize(Engine::Get().GetWindow().GetWidth(), Engine::Get().GetWindow().GetHeight())
+    {
+        m_StaticSprites.Connect(m_Registry.Raw());
+    }
 
     Scene::~Scene() {
         m_Barrier.Wait();
+        m_StaticSprites.Disconnect(m_Registry.Raw());
     }
 
     Ref<Scene> Scene::Copy(const Ref<Scene>& other) {
         Ref<Scene> scene = NewRef<Scene>();
         scene->m_ViewportSize = other->m_ViewportSize;
+        scene->m_SimulationSettings = other->m_SimulationSettings;
 
         other->m_Registry.View<IDComponent>([&](entt::entity entity, IDComponent& id) {
             Entity oldEntity(entity, other.get());
@@ -67,6 +100,7 @@ namespace Vanta {
     void Scene::OnRuntimeBegin() {
         VANTA_PROFILE_FUNCTION();
         ResetCommandDiagnostics();
+        ResetFixedSteps();
         InitPhysics();
         InitScripts();
     }
@@ -77,11 +111,13 @@ namespace Vanta {
         DestroyScripts();
         DestroyPhysics();
         FlushCommands();
+        ResetFixedSteps();
     }
 
     void Scene::OnSimulationBegin() {
         VANTA_PROFILE_FUNCTION();
         ResetCommandDiagnostics();
+        ResetFixedSteps();
         InitPhysics();
     }
 
@@ -89,6 +125,7 @@ namespace Vanta {
         VANTA_PROFILE_FUNCTION();
         DestroyPhysics();
         FlushCommands();
+        ResetFixedSteps();
     }
 
     void Scene::InitScripts() {
@@ -149,6 +186,13 @@ namespace Vanta {
         worldDef.gravity = { 0.f, -gravity };
         worldDef.restitutionThreshold = restitutionThreshold;
 
+        // Spread the solver over the engine's fiber workers, rather than a thread pool of its own
+        auto tasks = NewBox<PhysicsTasks>(m_SimulationSettings.PhysicsWorkers);
+        if (tasks->GetWorkerCount() > 1) {
+            tasks->Configure(worldDef);
+            m_PhysicsTasks = std::move(tasks);
+        }
+
         m_PhysicsWorld = b2CreateWorld(&worldDef);
 
         m_Registry.View<TransformComponent, Rigidbody2DComponent>(
@@ -160,6 +204,7 @@ namespace Vanta {
             bodyDef.type = detail::Rigidbody2DTypeToBox2D(rb.Type);
             bodyDef.position = { tr.GetPosition().x, tr.GetPosition().y };
             bodyDef.rotation = b2MakeRot(tr.GetRotationRadians().z);
+            bodyDef.userData = detail::EntityToBodyUserData(e);
 
             b2BodyId body = b2CreateBody(m_PhysicsWorld, &bodyDef);
             b2Body_SetFixedRotation(body, rb.FixedRotation);
@@ -198,6 +243,7 @@ namespace Vanta {
     void Scene::DestroyPhysics() {
         b2DestroyWorld(m_PhysicsWorld);
         m_PhysicsWorld = b2_nullWorldId;
+        m_PhysicsTasks.reset();
     }
 
     void Scene::OnUpdateRuntime(double delta) {
@@ -205,16 +251,12 @@ namespace Vanta {
         m_Barrier.Wait();
 
         if (!m_IsPaused) {
-            OnScriptUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Script);
-            OnPhysicsUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Physics);
+            const uint steps = ConsumeFixedSteps(delta);
+            for (uint i = 0; i < steps; i++)
+                OnFixedUpdate(true, i + 1 == steps);
         }
         else if (m_StepFrames > 0) {
-            OnScriptUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Script);
-            OnPhysicsUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Physics);
+            OnFixedUpdate(true, true);
             m_StepFrames--;
         }
 
@@ -226,12 +268,12 @@ namespace Vanta {
         m_Barrier.Wait();
 
         if (!m_IsPaused) {
-            OnPhysicsUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Physics);
+            const uint steps = ConsumeFixedSteps(delta);
+            for (uint i = 0; i < steps; i++)
+                OnFixedUpdate(false, i + 1 == steps);
         }
         else if (m_StepFrames > 0) {
-            OnPhysicsUpdate(delta);
-            ApplyCommandsPhase(CommandPhase::Physics);
+            OnFixedUpdate(false, true);
             m_StepFrames--;
         }
 
@@ -244,6 +286,114 @@ namespace Vanta {
         OnRender(delta, camera);
     }
 
+    void Scene::SetSimulationSettings(const SimulationSettings& settings) {
+        VANTA_CORE_ASSERT(settings.TickRate > 0.0, "Simulation tick rate must be positive!");
+        VANTA_CORE_ASSERT(settings.MaxStepsPerFrame > 0, "Simulation must be allowed at least one step per frame!");
+        m_SimulationSettings = settings;
+        m_StepAccumulator = std::min(m_StepAccumulator, GetFixedDelta());
+    }
+
+    double Scene::GetInterpolationAlpha() const {
+        if (!m_Interpolating || m_IsPaused)
+            return 1.0;
+        return std::clamp(m_StepAccumulator / GetFixedDelta(), 0.0, 1.0);
+    }
+
+    void Scene::ResetFixedSteps() {
+        m_StepAccumulator = 0.0;
+        m_Interpolating = false;
+        m_PreviousTransforms.clear();
+        m_SnapshotStorage = nullptr;
+    }
+
+    uint Scene::ConsumeFixedSteps(double delta) {
+        const double step = GetFixedDelta();
+        m_StepAccumulator += delta;
+
+        uint steps = 0;
+        while (m_StepAccumulator >= step && steps < m_SimulationSettings.MaxStepsPerFrame) {
+            m_StepAccumulator -= step;
+            steps++;
+        }
+
+        // Too far behind to catch up, drop the backlog rather than spiral into ever longer frames
+        if (m_StepAccumulator >= step)
+            m_StepAccumulator = std::fmod(m_StepAccumulator, step);
+
+        return steps;
+    }
+
+    void Scene::OnFixedUpdate(bool updateScripts, bool lastStep) {
+        VANTA_PROFILE_FUNCTION();
+        const double step = GetFixedDelta();
+
+        // Rendering only ever interpolates between the last two steps of a frame,
+        // so earlier steps don't need the transforms they started from
+        if (lastStep)
+            CaptureTransformSnapshot();
+
+        if (updateScripts) {
+            OnScriptUpdate(step);
+            ApplyCommandsPhase(CommandPhase::Script);
+        }
+
+        OnPhysicsUpdate(step);
+        ApplyCommandsPhase(CommandPhase::Physics);
+    }
+
+    void Scene::CaptureTransformSnapshot() {
+        m_Interpolating = m_SimulationSettings.Interpolate;
+        if (!m_Interpolating) {
+            m_PreviousTransforms.clear();
+            return;
+        }
+
+        VANTA_PROFILE_FUNCTION();
+        auto& transforms = m_Registry.Raw().storage<TransformComponent>();
+        m_SnapshotStorage = &transforms;
+        m_PreviousTransforms.resize(transforms.size());
+
+        // Entries that still match their transform already hold its current value
+        const entt::entity* entities = transforms.data();
+        for (usize i = 0; i < transforms.size(); i++) {
+            const TransformComponent& tr = transforms.get(entities[i]);
+            TransformSnapshot& previous = m_PreviousTransforms[i];
+            if (previous.Entity == entities[i] && previous.Version == tr.GetVersion())
+                continue;
+
+            previous = { entities[i], tr.GetVersion(), tr.GetPosition(), tr.GetRotationRadians(), tr.GetScale() };
+        }
+    }
+
+    glm::mat4 Scene::GetRenderTransform(entt::entity entity) {
+        return GetRenderTransform(entity, GetComponent<TransformComponent>(entity));
+    }
+
+    glm::mat4 Scene::GetRenderTransform(entt::entity entity, TransformComponent& tr) {
+        if (!IsInterpolated(entity, tr))
+            return tr.GetTransform();
+
+        const TransformSnapshot& previous = m_PreviousTransforms[m_SnapshotStorage->index(entity)];
+        const float t = (float)GetInterpolationAlpha();
+        const glm::vec3 position = glm::mix(previous.Position, tr.GetPosition(), t);
+        const glm::quat rotation = glm::slerp(glm::quat(previous.Rotation), glm::quat(tr.GetRotationRadians()), t);
+        const glm::vec3 scale = glm::mix(previous.Scale, tr.GetScale(), t);
+
+        return glm::translate(glm::mat4(1.f), position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.f), scale);
+    }
+
+    bool Scene::IsInterpolated(entt::entity entity, const TransformComponent& tr) const {
+        if (GetInterpolationAlpha() >= 1.0 || !m_SnapshotStorage || !m_SnapshotStorage->contains(entity))
+            return false;
+
+        // Entities added or moved within the storage since the snapshot have no entry of their own
+        const usize index = m_SnapshotStorage->index(entity);
+        if (index >= m_PreviousTransforms.size() || m_PreviousTransforms[index].Entity != entity)
+            return false;
+
+        return m_PreviousTransforms[index].Version != tr.GetVersion();
+    }
+
     void Scene::OnScriptUpdate(double delta) {
         VANTA_PROFILE_FUNCTION();
 
@@ -261,31 +411,69 @@ namespace Vanta {
     void Scene::OnPhysicsUpdate(double delta) {
         VANTA_PROFILE_FUNCTION();
 
-        const uint subStepCount = 4; // TODO: Move to a config variable
-        b2World_Step(m_PhysicsWorld, (float)delta, subStepCount);
+        b2World_Step(m_PhysicsWorld, (float)delta, (int)m_SimulationSettings.PhysicsSubSteps);
+        if (m_PhysicsTasks)
+            m_PhysicsTasks->Reset();
 
-        View<TransformComponent, Rigidbody2DComponent>(
-            [&](entt::entity e, TransformComponent& tr, Rigidbody2DComponent& rb)
-        {
-            b2Vec2 position = b2Body_GetPosition(rb.RuntimeBody);
-            b2Rot rotation = b2Body_GetRotation(rb.RuntimeBody);
-            float angle = b2Rot_GetAngle(rotation);
-
-            EnqueueTransformCommand(SetTransformCommand{
-                { e, CommandSource::Physics, CommandPhase::Physics },
-                { position.x, position.y, tr.GetPosition().z },
-                { 0.f, 0.f, angle },
-                tr.GetScale()
+        OnPhysicsWriteback();
+    }
+
+    void Scene::OnPhysicsWriteback() {
+        VANTA_PROFILE_FUNCTION();
+
+        // Only bodies that moved during the last step are reported, so sleeping and static bodies cost nothing
+        const b2BodyEvents events = b2World_GetBodyEvents(m_PhysicsWorld);
+        const usize count = (usize)events.moveCount;
+        if (count == 0)
+            return;
+
+        // Fetched up front, since looking up storage may create it
+        auto& transforms = m_Registry.Raw().storage<TransformComponent>();
+
+        auto writeback = [&](usize begin, usize end) {
+            m_CommandQueues.EnqueueTransformCommands(CommandPhase::Physics, end - begin, [&](SetTransformCommand* out) {
+                usize written = 0;
+                for (usize i = begin; i < end; i++) {
+                    const b2BodyMoveEvent& move = events.moveEvents[i];
+                    const entt::entity e = detail::BodyUserDataToEntity(move.userData);
+                    if (!transforms.contains(e))
+                        continue;
+
+                    const TransformComponent& tr = transforms.get(e);
+                    out[written++] = SetTransformCommand{
+                        { e, CommandSource::Physics, CommandPhase::Physics },
+                        { move.transform.p.x, move.transform.p.y, tr.GetPosition().z },
+                        { 0.f, 0.f, b2Rot_GetAngle(move.transform.q) },
+                        tr.GetScale()
+                    };
+                }
+                return written;
             });
-        });
+        };
+
+        const usize chunkSize = detail::ParallelChunkSize(count);
+        const usize jobCount = (count + chunkSize - 1) / chunkSize;
+        if (jobCount <= 1) {
+            writeback(0, count);
+            return;
+        }
+
+        // Every job writes into the staging buffer of the thread it runs on
+        auto job = [&](usize index) {
+            const usize begin = index * chunkSize;
+            writeback(begin, std::min(count, begin + chunkSize));
+        };
+
+        JobCounter counter;
+        Fibers::Dispatch(counter, jobCount, job);
+        counter.Wait();
     }
 
     void Scene::OnRender(double delta, entt::entity camera) {
         VANTA_PROFILE_RENDER_FUNCTION();
         if (IsValid(camera)) {
-            TransformComponent& tr = GetComponent<TransformComponent>(camera);
             auto& cc = GetComponent<CameraComponent>(camera);
-            cc.Camera->SetView(glm::inverse(tr.GetTransform()));
+            cc.Camera->SetView(glm::inverse(GetRenderTransform(camera)));
             OnRender(delta, cc.Camera.get());
         }
     }
@@ -293,17 +481,158 @@ namespace Vanta {
     void Scene::OnRender(double, Camera* camera) {
         VANTA_PROFILE_RENDER_FUNCTION();
         if (camera) {
+            const glm::mat4 viewProjection = camera->GetViewProjection();
+            const Frustum frustum(viewProjection);
+
+            m_RenderQueue.Clear();
+            ExtractCircles(viewProjection, frustum);
+            ExtractSprites(viewProjection, frustum);
+            m_RenderQueue.Sort();
+
             Renderer2D::SceneBegin(camera);
+            m_StaticSprites.Draw(frustum);
+            SubmitRenderQueue();
+            Renderer2D::SceneEnd();
+        }
+    }
 
-            View<TransformComponent, CircleRendererComponent>([&](entt::entity entity, TransformComponent& tr, CircleRendererComponent& cr) {
-                Renderer2D::DrawCircle(tr.GetTransform(), cr.Color, cr.Thickness, cr.Fade, (uint32)entity);
-            });
+    void Scene::ExtractCircles(const glm::mat4& viewProjection, const Frustum& frustum) {
+        VANTA_PROFILE_RENDER_FUNCTION();
 
-            View<TransformComponent, SpriteComponent>([&](entt::entity entity, TransformComponent& tr, SpriteComponent& sp) {
-                Renderer2D::DrawSprite(tr.GetTransform(), sp, (uint32)entity);
-            });
+        usize culled = 0;
+        m_CircleDraws.clear();
+        View<TransformComponent, CircleRendererComponent>([&](entt::entity entity, TransformComponent& tr, CircleRendererComponent&) {
+            const glm::mat4 transform = GetRenderTransform(entity, tr);
+            if (!frustum.Intersects(BoundingBox::FromQuad(transform))) {
+                culled++;
+                return;
+            }
 
-            Renderer2D::SceneEnd();
+            // Circle edges fade, so they always blend
+            const uint64 key = RenderQueue::MakeKey(RenderQueue::Layer::Translucent,
+                detail::RenderDepth(viewProjection, transform), detail::CircleShader, 0);
+
+            m_RenderQueue.Push(key, detail::RENDER_PAYLOAD_CIRCLE | m_CircleDraws.size());
+            m_CircleDraws.push_back({ transform, entity });
+        });
+
+        Renderer2D::RecordCulling(m_CircleDraws.size(), culled);
+    }
+
+    void Scene::ExtractSprites(const glm::mat4& viewProjection, const Frustum& frustum) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        auto view = m_Registry.View<TransformComponent, SpriteComponent>();
+        const usize count = view.handle() ? view.handle()->size() : 0;
+        if (count == 0) {
+            // Chunks may still need clearing out after sprites were removed
+            m_StaticSprites.Rebuild(m_Registry.Raw());
+            return;
+        }
+
+        // Every job extracts a fixed, contiguous range of sprites into lists of its own.
+        // Draws are queued in job order, so they come out the same however jobs were scheduled.
+        const usize workers = std::max<usize>(Fibers::THREAD_COUNT, 1);
+        const usize jobCount = std::clamp<usize>(count / SPRITE_EXTRACT_MIN_PER_JOB, 1, workers);
+        if (m_SpriteExtracts.size() < jobCount)
+            m_SpriteExtracts.resize(jobCount);
+
+        auto extract = [&](usize job) {
+            const usize begin = count * job / jobCount;
+            const usize end = count * (job + 1) / jobCount;
+
+            SpriteExtract& extracted = m_SpriteExtracts[job];
+            extracted.Sprites.Clear();
+            extracted.Sprites.Reserve(end - begin);
+            extracted.Draws.clear();
+            extracted.Draws.reserve(end - begin);
+            extracted.Culled = 0;
+            extracted.DirtyChunks.clear();
+            extracted.Settled.clear();
+
+            auto addSprite = [&](entt::entity entity, TransformComponent& tr, SpriteComponent& sp) {
+                // Sprites that haven't changed in a while are drawn from the static cache instead
+                StaticSpriteCache::Record& record = m_StaticSprites.GetRecord(entity);
+                uint32 chunk = StaticSpriteCache::NO_CHUNK;
+                if (StaticSpriteCache::Update(record, tr, sp, chunk)) {
+                    if (chunk != StaticSpriteCache::NO_CHUNK)
+                        extracted.DirtyChunks.push_back(chunk);
+                }
+                else if (record.Chunk != StaticSpriteCache::NO_CHUNK) {
+                    return;
+                }
+                else if (StaticSpriteCache::IsSettled(record) && detail::IsOpaque(sp)
+                    && !m_Registry.HasComponent<Rigidbody2DComponent>(entity) && !IsInterpolated(entity, tr))
+                {
+                    extracted.Settled.push_back(entity);
+                    return;
+                }
+
+                const glm::mat4 transform = GetRenderTransform(entity, tr);
+                if (!frustum.Intersects(BoundingBox::FromQuad(transform))) {
+                    extracted.Culled++;
+                    return;
+                }
+                const uint64 key = RenderQueue::MakeKey(
+                    detail::IsOpaque(sp) ? RenderQueue::Layer::Opaque : RenderQueue::Layer::Translucent,
+                    detail::RenderDepth(viewProjection, transform), detail::QuadShader,
+                    Renderer2D::GetTextureSortKey(sp.Texture.get()));
+
+                extracted.Draws.push_back({ key, ((uint64)job << 32) | extracted.Sprites.Size() });
+                extracted.Sprites.AddSprite(transform, sp, (uint32)entity);
+            };
+            detail::ProcessViewRange(view, addSprite, begin, end);
+        };
+
+        if (jobCount == 1) {
+            extract(0);
+        }
+        else {
+            JobCounter counter;
+            Fibers::Dispatch(counter, jobCount, extract);
+            counter.Wait();
+        }
+
+        for (usize job = 0; job < jobCount; job++) {
+            const SpriteExtract& extracted = m_SpriteExtracts[job];
+            std::copy(extracted.Draws.begin(), extracted.Draws.end(), m_RenderQueue.Append(extracted.Draws.size()));
+            Renderer2D::RecordCulling(extracted.Draws.size(), extracted.Culled);
+
+            for (uint32 chunk : extracted.DirtyChunks)
+                m_StaticSprites.MarkDirty(chunk);
+            for (entt::entity entity : extracted.Settled)
+                m_StaticSprites.MarkSettled(entity);
+        }
+
+        m_StaticSprites.Rebuild(m_Registry.Raw());
+    }
+
+    void Scene::SubmitRenderQueue() {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        bool first = true;
+        bool lastCircle = false;
+
+        for (const RenderQueue::Item& item : m_RenderQueue) {
+            const bool circle = (item.Payload & detail::RENDER_PAYLOAD_CIRCLE) != 0;
+
+            // Quads and circles are drawn apart within a batch,
+            // so keep translucent draws in order by flushing when switching between them
+            if (!first && circle != lastCircle && RenderQueue::GetLayer(item.Key) == RenderQueue::Layer::Translucent)
+                Renderer2D::Flush();
+            first = false;
+            lastCircle = circle;
+
+            if (circle) {
+                const CircleDraw& draw = m_CircleDraws[item.Payload & ~detail::RENDER_PAYLOAD_CIRCLE];
+                const auto& cr = GetComponent<CircleRendererComponent>(draw.Entity);
+                Renderer2D::DrawCircle(draw.Transform, cr.Color, cr.Thickness, cr.Fade, (uint32)draw.Entity);
+            }
+            else {
+                const usize job = (usize)(item.Payload >> 32);
+                const usize index = (usize)(item.Payload & 0xffffffff);
+                Renderer2D::DrawQuad(m_SpriteExtracts[job].Sprites, index);
+            }
         }
     }
 
@@ -322,6 +651,20 @@ namespace Vanta {
         return entity;
     }
 
+    void Scene::CreateEntities(const std::vector<IDComponent>& ids, const std::vector<TransformComponent>& transforms, std::vector<entt::entity>& entities) {
+        VANTA_PROFILE_FUNCTION();
+        VANTA_CORE_ASSERT(ids.size() == transforms.size(), "Every entity needs an ID and a transform!");
+
+        entities.resize(ids.size());
+        m_Registry.Create(entities.begin(), entities.end());
+        m_Registry.InsertComponents<IDComponent>(entities.begin(), entities.end(), ids.begin());
+        m_Registry.InsertComponents<TransformComponent>(entities.begin(), entities.end(), transforms.begin());
+
+        m_EntityMap.reserve(m_EntityMap.size() + ids.size());
+        for (usize i = 0; i < ids.size(); i++)
+            m_EntityMap[ids[i].ID] = entities[i];
+    }
+
     Entity Scene::DuplicateEntity(entt::entity entity) {
         VANTA_PROFILE_FUNCTION();
         Entity e(entity, this);
@@ -2,8 +2,13 @@
 #include "Vanta/Scene/SceneRegistry.hpp"
 #include "Vanta/Scene/SceneCommandQueues.hpp"
 #include "Vanta/Scene/Dispatch.hpp"
+#include "Vanta/Scene/PhysicsTasks.hpp"
 #include "Vanta/Scene/SceneCamera.hpp"
+#include "Vanta/Scene/StaticSpriteCache.hpp"
 #include "Vanta/Render/Camera.hpp"
+#include "Vanta/Render/Frustum.hpp"
+#include "Vanta/Render/Renderer2D.hpp"
+#include "Vanta/Render/RenderQueue.hpp"
 
 struct b2WorldId;
 
@@ -11,6 +16,18 @@ namespace Vanta {
 
     class Entity;
 
+    /// <summary>
+    /// Fixed timestep settings of a scene's simulation.
+    /// Scripts and physics advance in steps of `1 / TickRate` seconds, independent of the frame rate.
+    /// </summary>
+    struct SimulationSettings {
+        double TickRate = 60.0;     ///< Simulation steps per second
+        uint MaxStepsPerFrame = 8;  ///< Most steps run in a single frame to catch up; any further backlog is dropped
+        uint PhysicsSubSteps = 4;   ///< Physics solver sub-steps per simulation step
+        uint PhysicsWorkers = 0;    ///< Fiber workers the physics solver is spread over; 0 uses all, 1 keeps it on the calling thread
+        bool Interpolate = true;    ///< Render transforms interpolated between the last two simulation steps
+    };
+
     class Scene {
     public:
         using Registry = SceneRegistry;
@@ -33,6 +50,13 @@ namespace Vanta {
         bool IsValid(entt::entity entity) const;
         Entity CreateEntity(const std::string& name, UUID uuid = UUID());
         Entity DuplicateEntity(entt::entity entity);
+
+        /// <summary>
+        /// Create many entities at once, as when loading a scene.
+        /// Handles, IDs and transforms are all added in bulk, instead of one entity at a time.
+        /// The new entities are returned in `entities`, in the order of `ids`.
+        /// </summary>
+        void CreateEntities(const std::vector<IDComponent>& ids, const std::vector<TransformComponent>& transforms, std::vector<entt::entity>& entities);
         void DestroyEntity(entt::entity entity);
 
         Entity GetEntityByID(UUID uuid);
@@ -57,6 +81,15 @@ namespace Vanta {
             return component;
         }
 
+        /// <summary>
+        /// Add a given component to many entities at once, copied from a range of components.
+        /// Unlike `AddComponent`, no per-component setup is run.
+        /// </summary>
+        template<typename Component, typename It>
+        void InsertComponents(const std::vector<entt::entity>& entities, It components) {
+            m_Registry.InsertComponents<Component>(entities.begin(), entities.end(), components);
+        }
+
         /// <summary>
         /// Add to replace a given component to an entity.
         /// </summary>
@@ -106,6 +139,22 @@ namespace Vanta {
 
         void Step(uint frames = 1) { m_StepFrames = frames; }
 
+        const SimulationSettings& GetSimulationSettings() const { return m_SimulationSettings; }
+        void SetSimulationSettings(const SimulationSettings& settings);
+
+        double GetFixedDelta() const { return 1.0 / m_SimulationSettings.TickRate; }
+
+        /// <summary>
+        /// How far rendering is between the previous and the latest simulation step, in [0, 1].
+        /// </summary>
+        double GetInterpolationAlpha() const;
+
+        /// <summary>
+        /// Transform an entity is rendered with.
+        /// While simulating, this is interpolated between the last two simulation steps.
+        /// </summary>
+        glm::mat4 GetRenderTransform(entt::entity entity);
+
         void OnViewportResize(uint width, uint height);
 
         void SetActiveCameraEntity(entt::entity camera);
@@ -126,12 +175,13 @@ namespace Vanta {
         void ApplyTransformCommands(CommandPhase phase) { m_CommandQueues.ApplyTransformCommands(m_Registry, phase); }
         void FlushTransformCommands() { m_CommandQueues.FlushTransformCommands(); }
         void ResetTransformCommandDiagnostics() { m_CommandQueues.ResetTransformCommandDiagnostics(); }
-        const CommandQueueDiagnostics& GetTransformCommandDiagnostics() const { return m_CommandQueues.GetTransformCommandDiagnostics(); }
+        CommandQueueDiagnostics GetTransformCommandDiagnostics() const { return m_CommandQueues.GetTransformCommandDiagnostics(); }
 
     private:
         Registry m_Registry;
         SceneCommandQueues m_CommandQueues;
         b2WorldId m_PhysicsWorld;
+        Box<PhysicsTasks> m_PhysicsTasks;
         ParallelBarrier m_Barrier;
 
         glm::uvec2 m_ViewportSize;
@@ -140,15 +190,66 @@ namespace Vanta {
         bool m_IsPaused = false;
         uint m_StepFrames = 0;
 
+        SimulationSettings m_SimulationSettings;
+        double m_StepAccumulator = 0.0;
+        bool m_Interpolating = false;
+
+        // Transforms as they were before the latest simulation step, at the storage index of each transform.
+        // An entry is only copied again once its transform's version has moved on, so static entities cost
+        // a version check per step.
+        struct TransformSnapshot {
+            entt::entity Entity = entt::null;
+            uint32 Version = 0;
+            glm::vec3 Position;
+            glm::vec3 Rotation;
+            glm::vec3 Scale;
+        };
+        std::vector<TransformSnapshot> m_PreviousTransforms;
+        const entt::storage_for_t<TransformComponent>* m_SnapshotStorage = nullptr;
+
+        /// Fewest sprites worth handing to a fiber when extracting them for rendering.
+        static constexpr usize SPRITE_EXTRACT_MIN_PER_JOB = 1024;
+
+        // Sprite quads and their draws extracted by every job, reused between frames
+        struct SpriteExtract {
+            QuadList Sprites;
+            std::vector<RenderQueue::Item> Draws;
+            usize Culled = 0;
+
+            std::vector<uint32> DirtyChunks;        // Static chunks with a sprite that changed
+            std::vector<entt::entity> Settled;      // Sprites ready to be cached
+        };
+        std::vector<SpriteExtract> m_SpriteExtracts;
+
+        struct CircleDraw {
+            glm::mat4 Transform;
+            entt::entity Entity;
+        };
+        std::vector<CircleDraw> m_CircleDraws;
+
+        RenderQueue m_RenderQueue;
+        StaticSpriteCache m_StaticSprites;
+
         std::unordered_map<UUID, entt::entity> m_EntityMap;
 
         void InitScripts();
         void InitPhysics();
 
+        void ResetFixedSteps();
+        uint ConsumeFixedSteps(double delta);
+        void OnFixedUpdate(bool updateScripts, bool lastStep);
+        void CaptureTransformSnapshot();
+        glm::mat4 GetRenderTransform(entt::entity entity, TransformComponent& tr);
+        bool IsInterpolated(entt::entity entity, const TransformComponent& tr) const;
+
         void OnScriptUpdate(double delta);
         void OnPhysicsUpdate(double delta);
+        void OnPhysicsWriteback();
         void OnRender(double delta, entt::entity camera);
         void OnRender(double delta, Camera* camera);
+        void ExtractSprites(const glm::mat4& viewProjection, const Frustum& frustum);
+        void ExtractCircles(const glm::mat4& viewProjection, const Frustum& frustum);
+        void SubmitRenderQueue();
 
         void DestroyScripts();
         void DestroyPhysics();
@@ -11,6 +11,11 @@ namespace Vanta {
         void EnqueueTransformCommand(const SetScaleCommand& command) { m_TransformCommands.Enqueue(command); }
         void EnqueueTransformCommand(const SetTransformCommand& command) { m_TransformCommands.Enqueue(command); }
 
+        template<typename Fill>
+        usize EnqueueTransformCommands(CommandPhase phase, usize count, Fill&& fill) {
+            return m_TransformCommands.EnqueueTransforms(phase, count, std::forward<Fill>(fill));
+        }
+
         template<typename Registry>
         void ApplyPhase(Registry& registry, CommandPhase phase) {
             if constexpr (requires { registry.Raw(); }) {
@@ -37,7 +42,7 @@ namespace Vanta {
         void FlushTransformCommands() { Flush(); }
         void ResetTransformCommandDiagnostics() { ResetDiagnostics(); }
 
-        const CommandQueueDiagnostics& GetTransformCommandDiagnostics() const {
+        CommandQueueDiagnostics GetTransformCommandDiagnostics() const {
             return m_TransformCommands.GetDiagnostics();
         }
 
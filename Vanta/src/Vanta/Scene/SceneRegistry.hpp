@@ -21,6 +21,14 @@ namespace Vanta {
             return m_Registry.create();
         }
 
+        /// <summary>
+        /// Create entities for a whole range of handles at once.
+        /// </summary>
+        template<typename It>
+        void Create(It first, It last) {
+            m_Registry.create(first, last);
+        }
+
         void Destroy(entt::entity entity) {
             m_Registry.destroy(entity);
         }
@@ -107,6 +115,14 @@ namespace Vanta {
             return m_Registry.emplace_or_replace<Component>(entity, std::forward<Args>(args)...);
         }
 
+        /// <summary>
+        /// Add a component to a range of entities at once, copied from a range of components.
+        /// </summary>
+        template<typename Component, typename EntityIt, typename ComponentIt>
+        void InsertComponents(EntityIt first, EntityIt last, ComponentIt from) {
+            m_Registry.insert<Component>(first, last, from);
+        }
+
         template<typename Component>
         void RemoveComponent(entt::entity entity) {
             m_Registry.remove<Component>(entity);
@@ -1,5 +1,7 @@
 #include "vantapch.hpp"
+#include "Vanta/Asset/AssetManager.hpp"
 #include "Vanta/Project/Project.hpp"
+#include "Vanta/Scene/BinarySerializer.hpp"
 #include "Vanta/Scene/Entity.hpp"
 #include "Vanta/Scene/Serializer.hpp"
 #include "Vanta/Scripts/Field.hpp"
@@ -278,7 +280,22 @@ namespace Vanta {
     }
 
     void SceneSerializer::Serialize(const Ref<Scene>& scene) {
-        YAML::Emitter out;
+        VANTA_PROFILE_FUNCTION();
+
+        m_Index = None;
+
+        // Emit straight into a file next to the scene, so big scenes don't build up in memory.
+        // It only replaces the scene once it's written in full, so a failed write leaves the old file intact.
+        Path tempPath = m_File.Filepath;
+        tempPath += ".tmp";
+
+        std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file) {
+            VANTA_CORE_ERROR("Failed to open file: '{}'", tempPath);
+            return;
+        }
+
+        YAML::Emitter out(file);
         out << YAML::BeginMap;
 
         out << YAML::Key << "Scene" << YAML::Value;
@@ -311,224 +328,211 @@ namespace Vanta {
         }
 
         out << YAML::EndMap;
-        m_File.Write(out.c_str());
-    }
+        file.close();
 
-    bool SceneSerializer::Deserialize(Ref<Scene>& scene) {
-        std::string text = m_File.Read();
+        std::error_code error;
+        if (!out.good() || !file) {
+            VANTA_CORE_ERROR("Failed to write scene file: '{}'; {}", m_File.Filepath, out.good() ? "stream error" : out.GetLastError());
+            std::filesystem::remove(tempPath, error);
+            return;
+        }
 
-        YAML::Node root;
-        try {
-            root = YAML::Load(text);
+        std::filesystem::rename(tempPath, m_File.Filepath, error);
+        if (error) {
+            VANTA_CORE_ERROR("Failed to replace scene file: '{}'; {}", m_File.Filepath, error.message());
+            std::filesystem::remove(tempPath, error);
         }
-        catch (YAML::ParserException e) {
-            VANTA_CORE_ERROR("Failed to parse scene file: {}; {}", m_File.Filepath, e.what());
-            return false;
+    }
+
+    namespace TextScene {
+
+        struct CameraData {
+            int ProjectionType = 0;
+            float PerspectiveFOV = 0.f;
+            float PerspectiveNear = 0.f;
+            float PerspectiveFar = 0.f;
+            float OrthographicSize = 0.f;
+            float OrthographicNear = 0.f;
+            float OrthographicFar = 0.f;
+            bool FixedAspectRatio = false;
+        };
+
+        struct SpriteData {
+            std::string Texture; // Relative to the asset directory, empty if none
+            float TilingFactor = 1.f;
+            glm::vec4 Color = glm::vec4(1.f);
+        };
+
+        struct ScriptFieldData {
+            std::string Name;
+            Scripts::ScriptFieldType Type = Scripts::ScriptFieldType::None;
+            uint8 Value[16] = {};
+        };
+
+        struct ScriptData {
+            std::string ClassName;
+            std::vector<ScriptFieldData> Fields;
+        };
+
+        template<typename T>
+        struct Column {
+            std::vector<uint32> Entities; // Index of the entity within its batch
+            std::vector<T> Values;
+
+            T& Add(uint32 entity) {
+                Entities.push_back(entity);
+                return Values.emplace_back();
+            }
+        };
+
+        // Entities parsed by a single job, as per-component arrays.
+        // Only plain data is produced; anything touching the scene, scripts or assets waits for the insert.
+        struct EntityBatch {
+            std::vector<IDComponent> IDs;
+            std::vector<TransformComponent> Transforms;
+
+            Column<CameraData> Cameras;
+            Column<SpriteData> Sprites;
+            Column<CircleRendererComponent> CircleRenderers;
+            Column<Rigidbody2DComponent> Rigidbodies2D;
+            Column<BoxCollider2DComponent> BoxColliders2D;
+            Column<CircleCollider2DComponent> CircleColliders2D;
+            Column<ScriptData> CSharpScripts;
+            Column<ScriptData> NativeScripts;
+        };
+
+        // Shift nested lines to the first column, so they parse on their own
+        static std::string Dedent(std::string_view text) {
+            const usize indent = std::min(text.find_first_not_of(' '), text.size());
+            if (indent == 0)
+                return std::string(text);
+
+            std::string dedented;
+            dedented.reserve(text.size());
+            usize pos = 0;
+            while (pos < text.size()) {
+                usize end = text.find('\n', pos);
+                end = (end == std::string_view::npos) ? text.size() : end + 1;
+                const usize skip = std::min({ indent, text.find_first_not_of(' ', pos) - pos, end - pos });
+                dedented.append(text.substr(pos + skip, end - pos - skip));
+                pos = end;
+            }
+            return dedented;
         }
 
-        auto data = root["Scene"];
-        if (!data)
-            return false;
+        static void ParseScriptFields(const YAML::Node& node, ScriptData& script) {
+            auto scriptFields = node["Fields"];
+            if (!scriptFields)
+                return;
 
-        std::string sceneName = data["Name"].as<std::string>();
-        VANTA_CORE_TRACE("Deserializing scene: {}", sceneName);
+            for (auto scriptField : scriptFields) {
+                ScriptFieldData data;
+                data.Name = scriptField["Name"].as<std::string>();
+                data.Type = Scripts::ScriptFieldType::FromString(scriptField["Type"].as<std::string>());
 
-        // UUID of active camera
-        auto activeCamera = data["ActiveCamera"];
-        UUID activeCameraUUID = activeCamera ? UUID(activeCamera.as<uint64>()) : UUID();
+#define READ_SCRIPT_FIELD(fieldType, type) \
+case Scripts::ScriptFieldType::fieldType: { \
+    type value = scriptField["Value"].as<type>(); \
+    memcpy(data.Value, &value, sizeof(type)); \
+    break; \
+}
+                switch (data.Type) {
+                    READ_SCRIPT_FIELD(Bool, bool);
+                    READ_SCRIPT_FIELD(Char, char);
 
-        // Entity list
-        auto entities = data["Entities"];
-        if (!entities)
-            return false;
+                    READ_SCRIPT_FIELD(Int8, int8);
+                    READ_SCRIPT_FIELD(Int16, int16);
+                    READ_SCRIPT_FIELD(Int32, int32);
+                    READ_SCRIPT_FIELD(Int64, int64);
 
-        for (auto item : entities) {
-            auto entityNode = item["Entity"];
-            std::string name = entityNode[0].as<std::string>();
-            UUID uuid = entityNode[1].as<uint64>();
+                    READ_SCRIPT_FIELD(UInt8, uint8);
+                    READ_SCRIPT_FIELD(UInt16, uint16);
+                    READ_SCRIPT_FIELD(UInt32, uint32);
+                    READ_SCRIPT_FIELD(UInt64, uint64);
 
-            Entity entity = scene->CreateEntity(name, uuid);
+                    READ_SCRIPT_FIELD(Float, float);
+                    READ_SCRIPT_FIELD(Double, double);
 
-            VANTA_CORE_TRACE("Deserializing entity: {} [{}]", name, uuid);
+                    READ_SCRIPT_FIELD(Vector2, glm::vec2);
+                    READ_SCRIPT_FIELD(Vector3, glm::vec3);
+                    READ_SCRIPT_FIELD(Vector4, glm::vec4);
 
-            auto transformComponent = item["TransformComponent"];
-            if (transformComponent) {
-                auto pos = transformComponent["Position"].as<glm::vec3>();
-                auto rot = transformComponent["Rotation"].as<glm::vec3>();
-                auto scale = transformComponent["Scale"].as<glm::vec3>();
-                scene->EnqueueTransformCommand(SetTransformCommand{
-                    { entity.GetHandle(), CommandSource::Serialization, CommandPhase::Editor },
-                    pos,
-                    glm::radians(rot),
-                    scale
-                });
-                scene->ApplyTransformCommands(CommandPhase::Editor);
+                    READ_SCRIPT_FIELD(Entity, UUID);
+
+                default: continue;
+                }
+#undef READ_SCRIPT_FIELD
+
+                script.Fields.push_back(std::move(data));
             }
-            else {
+        }
+
+        // Parse an entity into a batch. May throw YAML exceptions.
+        static bool ParseEntity(const YAML::Node& item, EntityBatch& batch) {
+            const uint32 index = (uint32)batch.IDs.size();
+
+            auto entityNode = item["Entity"];
+            if (!entityNode.IsSequence() || entityNode.size() != 2) {
+                VANTA_CORE_ERROR("Entity has an unreadable header!");
+                return false;
+            }
+            batch.IDs.emplace_back(entityNode[0].as<std::string>(), UUID(entityNode[1].as<uint64>()));
+
+            auto transformComponent = item["TransformComponent"];
+            if (!transformComponent) {
                 VANTA_CORE_ERROR("Entity missing TransformComponent!");
                 return false;
             }
 
+            auto pos = transformComponent["Position"].as<glm::vec3>();
+            auto rot = transformComponent["Rotation"].as<glm::vec3>();
+            auto scale = transformComponent["Scale"].as<glm::vec3>();
+            batch.Transforms.emplace_back().SetTransformRad(pos, glm::radians(rot), scale);
+
             auto cameraComponent = item["CameraComponent"];
             if (cameraComponent) {
-                auto& cc = entity.AddComponent<CameraComponent>();
+                auto& cc = batch.Cameras.Add(index);
 
                 auto camera = cameraComponent["Camera"];
-                cc.Camera->SetProjectionType((SceneCamera::Projection)camera["ProjectionType"].as<int>());
+                cc.ProjectionType = camera["ProjectionType"].as<int>();
 
-                cc.Camera->SetPerspectiveFOV(camera["PerspectiveFOV"].as<float>());
-                cc.Camera->SetPerspectiveNearClip(camera["PerspectiveNear"].as<float>());
-                cc.Camera->SetPerspectiveFarClip(camera["PerspectiveFar"].as<float>());
+                cc.PerspectiveFOV = camera["PerspectiveFOV"].as<float>();
+                cc.PerspectiveNear = camera["PerspectiveNear"].as<float>();
+                cc.PerspectiveFar = camera["PerspectiveFar"].as<float>();
 
-                cc.Camera->SetOrthographicSize(camera["OrthographicSize"].as<float>());
-                cc.Camera->SetOrthographicNearClip(camera["OrthographicNear"].as<float>());
-                cc.Camera->SetOrthographicFarClip(camera["OrthographicFar"].as<float>());
+                cc.OrthographicSize = camera["OrthographicSize"].as<float>();
+                cc.OrthographicNear = camera["OrthographicNear"].as<float>();
+                cc.OrthographicFar = camera["OrthographicFar"].as<float>();
 
                 cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
             }
 
             auto scriptComponent = item["ScriptComponent"];
             if (scriptComponent) {
-                Scripts::CSharpScriptEngine& engine = Scripts::CSharpScriptEngine::Get();
-
-                auto& sc = entity.AddComponent<CSharpScriptComponent>();
+                auto& sc = batch.CSharpScripts.Add(index);
                 sc.ClassName = scriptComponent["Class"].as<std::string>();
-
-                if (!engine.EntityClassExists(sc.ClassName)) {
-                    VANTA_CORE_WARN("Class no longer exists: {}", sc.ClassName);
-                    goto after_csharp_script_component;
-                }
-
-                auto scriptFields = scriptComponent["Fields"];
-                if (scriptFields) {
-                    const auto& fields = engine.GetEntityClass(sc.ClassName)->GetFields();
-
-                    for (auto scriptField : scriptFields) {
-                        std::string fieldName = scriptField["Name"].as<std::string>();
-                        std::string typeName = scriptField["Type"].as<std::string>();
-                        Scripts::ScriptFieldType type = Scripts::ScriptFieldType::FromString(typeName);
-
-                        const auto& it = fields.find(fieldName);
-                        if (it == fields.end()) {
-                            VANTA_CORE_WARN("Field no longer exists: {}", fieldName);
-                            continue;
-                        }
-
-                        const auto& field = it->second;
-
-#define READ_SCRIPT_FIELD(fieldType, type) \
-    case Scripts::ScriptFieldType::fieldType: { \
-        type value = scriptField["Value"].as<type>(); \
-        engine.SetFieldInstance(entity, NewBox<Scripts::ScriptFieldBuffer<type>>(field, value)); \
-        break; \
-    }
-                        switch (type) {
-                            READ_SCRIPT_FIELD(Bool, bool);
-                            READ_SCRIPT_FIELD(Char, char);
-
-                            READ_SCRIPT_FIELD(Int8, int8);
-                            READ_SCRIPT_FIELD(Int16, int16);
-                            READ_SCRIPT_FIELD(Int32, int32);
-                            READ_SCRIPT_FIELD(Int64, int64);
-
-                            READ_SCRIPT_FIELD(UInt8, uint8);
-                            READ_SCRIPT_FIELD(UInt16, uint16);
-                            READ_SCRIPT_FIELD(UInt32, uint32);
-                            READ_SCRIPT_FIELD(UInt64, uint64);
-
-                            READ_SCRIPT_FIELD(Float, float);
-                            READ_SCRIPT_FIELD(Double, double);
-
-                            READ_SCRIPT_FIELD(Vector2, glm::vec2);
-                            READ_SCRIPT_FIELD(Vector3, glm::vec3);
-                            READ_SCRIPT_FIELD(Vector4, glm::vec4);
-
-                            READ_SCRIPT_FIELD(Entity, UUID);
-                        }
-#undef READ_SCRIPT_FIELD
-                    }
-                }
+                ParseScriptFields(scriptComponent, sc);
             }
-after_csharp_script_component:
 
             auto nativeScriptComponent = item["NativeScriptComponent"];
             if (nativeScriptComponent) {
-                Scripts::NativeScriptEngine& engine = Scripts::NativeScriptEngine::Get();
-                
-                auto& sc = entity.AddComponent<NativeScriptComponent>();
+                auto& sc = batch.NativeScripts.Add(index);
                 sc.ClassName = nativeScriptComponent["Class"].as<std::string>();
-
-                if (!engine.EntityClassExists(sc.ClassName)) {
-                    VANTA_CORE_WARN("Class no longer exists: {}", sc.ClassName);
-                    goto after_native_script_component;
-                }
-
-                auto scriptFields = scriptComponent["Fields"];
-                if (scriptFields) {
-                    const auto& fields = engine.GetEntityClass(sc.ClassName)->GetFields();
-
-                    for (auto scriptField : scriptFields) {
-                        std::string fieldName = scriptField["Name"].as<std::string>();
-                        std::string typeName = scriptField["Type"].as<std::string>();
-                        Scripts::ScriptFieldType type = Scripts::ScriptFieldType::FromString(typeName);
-
-                        const auto& it = fields.find(fieldName);
-                        if (it == fields.end()) {
-                            VANTA_CORE_WARN("Field no longer exists: {}", fieldName);
-                            continue;
-                        }
-
-                        const auto& field = it->second;
-
-#define READ_SCRIPT_FIELD(fieldType, type) \
-    case Scripts::ScriptFieldType::fieldType: { \
-        type value = scriptField["Value"].as<type>(); \
-        engine.SetFieldInstance(entity, NewBox<Scripts::ScriptFieldBuffer<type>>(field, value)); \
-        break; \
-    }
-                        switch (type) {
-                            READ_SCRIPT_FIELD(Bool, bool);
-                            READ_SCRIPT_FIELD(Char, char);
-
-                            READ_SCRIPT_FIELD(Int8, int8);
-                            READ_SCRIPT_FIELD(Int16, int16);
-                            READ_SCRIPT_FIELD(Int32, int32);
-                            READ_SCRIPT_FIELD(Int64, int64);
-
-                            READ_SCRIPT_FIELD(UInt8, uint8);
-                            READ_SCRIPT_FIELD(UInt16, uint16);
-                            READ_SCRIPT_FIELD(UInt32, uint32);
-                            READ_SCRIPT_FIELD(UInt64, uint64);
-
-                            READ_SCRIPT_FIELD(Float, float);
-                            READ_SCRIPT_FIELD(Double, double);
-
-                            READ_SCRIPT_FIELD(Vector2, glm::vec2);
-                            READ_SCRIPT_FIELD(Vector3, glm::vec3);
-                            READ_SCRIPT_FIELD(Vector4, glm::vec4);
-
-                            READ_SCRIPT_FIELD(Entity, UUID);
-                        }
-#undef READ_SCRIPT_FIELD
-                    }
-                }
+                ParseScriptFields(nativeScriptComponent, sc);
             }
-after_native_script_component:
 
             auto spriteComponent = item["SpriteComponent"];
             if (spriteComponent) {
-                auto& sp = entity.AddComponent<SpriteComponent>();
-                if (spriteComponent["Texture"]) {
-                    std::string texturePath = spriteComponent["Texture"].as<std::string>();
-                    sp.Texture = Texture2D::Create(Project::GetAssetPath(texturePath));
-                }
+                auto& sp = batch.Sprites.Add(index);
+                if (spriteComponent["Texture"])
+                    sp.Texture = spriteComponent["Texture"].as<std::string>();
                 sp.TilingFactor = spriteComponent["TilingFactor"].as<float>();
                 sp.Color = spriteComponent["Color"].as<glm::vec4>();
             }
 
             auto circleRendererComponent = item["CircleRendererComponent"];
             if (circleRendererComponent) {
-                auto& cr = entity.AddComponent<CircleRendererComponent>();
+                auto& cr = batch.CircleRenderers.Add(index);
                 cr.Color = circleRendererComponent["Color"].as<glm::vec4>();
                 cr.Thickness = circleRendererComponent["Thickness"].as<float>();
                 cr.Fade = circleRendererComponent["Fade"].as<float>();
@@ -536,14 +540,14 @@ after_native_script_component:
 
             auto rigidbody2DComponent = item["Rigidbody2DComponent"];
             if (rigidbody2DComponent) {
-                auto& rb = entity.AddComponent<Rigidbody2DComponent>();
+                auto& rb = batch.Rigidbodies2D.Add(index);
                 rb.Type = (Rigidbody2DComponent::BodyType)rigidbody2DComponent["BodyType"].as<int>();
                 rb.FixedRotation = rigidbody2DComponent["FixedRotation"].as<bool>();
             }
 
             auto boxCollider2DComponent = item["BoxCollider2DComponent"];
             if (boxCollider2DComponent) {
-                auto& bc = entity.AddComponent<BoxCollider2DComponent>();
+                auto& bc = batch.BoxColliders2D.Add(index);
                 bc.Size = boxCollider2DComponent["Size"].as<glm::vec2>();
                 bc.Offset = boxCollider2DComponent["Offset"].as<glm::vec2>();
                 bc.Density = boxCollider2DComponent["Density"].as<float>();
@@ -554,7 +558,7 @@ after_native_script_component:
 
             auto circleCollider2DComponent = item["CircleCollider2DComponent"];
             if (circleCollider2DComponent) {
-                auto& cc = entity.AddComponent<CircleCollider2DComponent>();
+                auto& cc = batch.CircleColliders2D.Add(index);
                 cc.Radius = circleCollider2DComponent["Radius"].as<float>();
                 cc.Offset = circleCollider2DComponent["Offset"].as<glm::vec2>();
                 cc.Density = circleCollider2DComponent["Density"].as<float>();
@@ -563,12 +567,504 @@ after_native_script_component:
                 cc.RollingResistance = circleCollider2DComponent["RollingResistance"].as<float>(0.1f);
             }
 
-            // Check for active camera entity
-            if (uuid == activeCameraUUID) {
-                scene->SetActiveCameraEntity(entity);
+            return true;
+        }
+
+        // Parse an entity from its own lines of the file. May throw YAML exceptions.
+        static bool ParseEntity(std::string_view lines, EntityBatch& batch) {
+            YAML::Node node = YAML::Load(Dedent(lines));
+            if (!node.IsSequence() || node.size() != 1)
+                return false;
+            return ParseEntity(node[0], batch);
+        }
+
+        // Call a function with every value of a column, and the entity it belongs to
+        template<typename T, typename Func>
+        static void ForEachInColumn(std::vector<EntityBatch>& batches, Column<T> EntityBatch::* column,
+            const std::vector<usize>& firsts, const std::vector<entt::entity>& entities, Func&& func)
+        {
+            for (usize b = 0; b < batches.size(); b++) {
+                Column<T>& values = batches[b].*column;
+                for (usize i = 0; i < values.Values.size(); i++)
+                    func(entities[firsts[b] + values.Entities[i]], values.Values[i]);
+            }
+        }
+
+        // Add the components of a column to their entities, all at once
+        template<typename Component, typename T, typename Func>
+        static void InsertColumn(Scene& scene, std::vector<EntityBatch>& batches, Column<T> EntityBatch::* column,
+            const std::vector<usize>& firsts, const std::vector<entt::entity>& entities, Func&& convert)
+        {
+            usize count = 0;
+            for (const EntityBatch& batch : batches)
+                count += (batch.*column).Values.size();
+            if (count == 0)
+                return;
+
+            std::vector<entt::entity> targets;
+            std::vector<Component> components;
+            targets.reserve(count);
+            components.reserve(count);
+
+            ForEachInColumn(batches, column, firsts, entities, [&](entt::entity entity, T& value) {
+                targets.push_back(entity);
+                convert(value, components.emplace_back());
+            });
+            scene.InsertComponents<Component>(targets, components.begin());
+        }
+
+        template<typename Engine>
+        static void InsertScriptFields(Scene& scene, std::vector<EntityBatch>& batches, Column<ScriptData> EntityBatch::* column,
+            const std::vector<usize>& firsts, const std::vector<entt::entity>& entities)
+        {
+            ForEachInColumn(batches, column, firsts, entities, [&](entt::entity handle, ScriptData& script) {
+                Engine& engine = Engine::Get();
+                if (!engine.EntityClassExists(script.ClassName)) {
+                    VANTA_CORE_WARN("Class no longer exists: {}", script.ClassName);
+                    return;
+                }
+
+                if (script.Fields.empty())
+                    return;
+
+                Entity entity(handle, &scene);
+                const auto& fields = engine.GetEntityClass(script.ClassName)->GetFields();
+
+                for (const ScriptFieldData& data : script.Fields) {
+                    const auto& it = fields.find(data.Name);
+                    if (it == fields.end()) {
+                        VANTA_CORE_WARN("Field no longer exists: {}", data.Name);
+                        continue;
+                    }
+
+                    const auto& field = it->second;
+
+#define SET_SCRIPT_FIELD(fieldType, type) \
+case Scripts::ScriptFieldType::fieldType: { \
+    type value; \
+    memcpy(&value, data.Value, sizeof(type)); \
+    engine.SetFieldInstance(entity, NewBox<Scripts::ScriptFieldBuffer<type>>(field, value)); \
+    break; \
+}
+                    switch (data.Type) {
+                        SET_SCRIPT_FIELD(Bool, bool);
+                        SET_SCRIPT_FIELD(Char, char);
+
+                        SET_SCRIPT_FIELD(Int8, int8);
+                        SET_SCRIPT_FIELD(Int16, int16);
+                        SET_SCRIPT_FIELD(Int32, int32);
+                        SET_SCRIPT_FIELD(Int64, int64);
+
+                        SET_SCRIPT_FIELD(UInt8, uint8);
+                        SET_SCRIPT_FIELD(UInt16, uint16);
+                        SET_SCRIPT_FIELD(UInt32, uint32);
+                        SET_SCRIPT_FIELD(UInt64, uint64);
+
+                        SET_SCRIPT_FIELD(Float, float);
+                        SET_SCRIPT_FIELD(Double, double);
+
+                        SET_SCRIPT_FIELD(Vector2, glm::vec2);
+                        SET_SCRIPT_FIELD(Vector3, glm::vec3);
+                        SET_SCRIPT_FIELD(Vector4, glm::vec4);
+
+                        SET_SCRIPT_FIELD(Entity, UUID);
+
+                    default: break;
+                    }
+#undef SET_SCRIPT_FIELD
+                }
+            });
+        }
+
+        // Create the entities of every batch and add their components, in batch order.
+        // Runs on the calling thread, which has to be the main one.
+        static void InsertEntities(Ref<Scene>& scene, std::vector<EntityBatch>& batches, std::vector<entt::entity>& entities) {
+            VANTA_PROFILE_FUNCTION();
+
+            std::vector<usize> firsts; // Index of each batch's first entity
+            std::vector<IDComponent> ids;
+            std::vector<TransformComponent> transforms;
+
+            usize count = 0;
+            for (const EntityBatch& batch : batches)
+                count += batch.IDs.size();
+            ids.reserve(count);
+            transforms.reserve(count);
+
+            for (EntityBatch& batch : batches) {
+                firsts.push_back(ids.size());
+                std::move(batch.IDs.begin(), batch.IDs.end(), std::back_inserter(ids));
+                transforms.insert(transforms.end(), batch.Transforms.begin(), batch.Transforms.end());
+            }
+
+            scene->CreateEntities(ids, transforms, entities);
+
+            // Cameras are added one by one, so the scene can set them up
+            ForEachInColumn(batches, &EntityBatch::Cameras, firsts, entities, [&](entt::entity entity, CameraData& data) {
+                auto& cc = scene->AddComponent<CameraComponent>(entity);
+                cc.Camera->SetProjectionType((SceneCamera::Projection)data.ProjectionType);
+
+                cc.Camera->SetPerspectiveFOV(data.PerspectiveFOV);
+                cc.Camera->SetPerspectiveNearClip(data.PerspectiveNear);
+                cc.Camera->SetPerspectiveFarClip(data.PerspectiveFar);
+
+                cc.Camera->SetOrthographicSize(data.OrthographicSize);
+                cc.Camera->SetOrthographicNearClip(data.OrthographicNear);
+                cc.Camera->SetOrthographicFarClip(data.OrthographicFar);
+
+                cc.FixedAspectRatio = data.FixedAspectRatio;
+            });
+
+            InsertColumn<CSharpScriptComponent>(*scene, batches, &EntityBatch::CSharpScripts, firsts, entities,
+                [](ScriptData& data, CSharpScriptComponent& sc) { sc.ClassName = data.ClassName; });
+            InsertScriptFields<Scripts::CSharpScriptEngine>(*scene, batches, &EntityBatch::CSharpScripts, firsts, entities);
+
+            InsertColumn<NativeScriptComponent>(*scene, batches, &EntityBatch::NativeScripts, firsts, entities,
+                [](ScriptData& data, NativeScriptComponent& sc) { sc.ClassName = data.ClassName; });
+            InsertScriptFields<Scripts::NativeScriptEngine>(*scene, batches, &EntityBatch::NativeScripts, firsts, entities);
+
+            InsertColumn<SpriteComponent>(*scene, batches, &EntityBatch::Sprites, firsts, entities,
+                [](SpriteData& data, SpriteComponent& sp) {
+                    if (!data.Texture.empty())
+                        sp.Texture = AssetManager::LoadTexture(Project::GetAssetPath(data.Texture));
+                    sp.TilingFactor = data.TilingFactor;
+                    sp.Color = data.Color;
+                });
+
+            auto copy = [](const auto& data, auto& component) { component = data; };
+            InsertColumn<CircleRendererComponent>(*scene, batches, &EntityBatch::CircleRenderers, firsts, entities, copy);
+            InsertColumn<Rigidbody2DComponent>(*scene, batches, &EntityBatch::Rigidbodies2D, firsts, entities, copy);
+            InsertColumn<BoxCollider2DComponent>(*scene, batches, &EntityBatch::BoxColliders2D, firsts, entities, copy);
+            InsertColumn<CircleCollider2DComponent>(*scene, batches, &EntityBatch::CircleColliders2D, firsts, entities, copy);
+        }
+
+        // Finds the top-level keys and entities of a scene file, one line at a time
+        class Indexer {
+        public:
+            Indexer(SceneFileIndex& index)
+                : m_Index(index) {}
+
+            // Items are told apart by indentation alone, as the emitter writes them:
+            // top-level keys start at the first column, and an entity runs from its
+            // `- Entity:` line up to the next line that's indented no deeper than its dash.
+            // Nothing is parsed here; a broken entity fails when its lines are parsed.
+            void Line(std::string_view text, uint64 begin) {
+                if (!text.empty() && text.back() == '\r')
+                    text.remove_suffix(1);
+
+                const usize indent = text.find_first_not_of(' ');
+                if (indent == std::string_view::npos || text[indent] == '#')
+                    return;
+
+                if (indent == 0 && text[0] != '-') {
+                    CloseEntity(begin);
+                    CloseKey(begin);
+
+                    const usize colon = text.find(':');
+                    if (colon != std::string_view::npos && text.substr(0, 3) != "---") {
+                        m_Key = text.substr(0, colon);
+                        m_KeyRange.Begin = begin;
+                    }
+                    return;
+                }
+
+                if (m_InEntity && indent <= m_EntityIndent)
+                    CloseEntity(begin);
+
+                constexpr std::string_view entityTag = "- Entity:";
+                const std::string_view item = text.substr(indent);
+                if (m_Key == "Scene" && item.starts_with(entityTag)) {
+                    m_InEntity = true;
+                    m_Entry.Lines.Begin = begin;
+                    m_Entry.Header = { begin + indent + entityTag.size(), begin + text.size() };
+                    m_EntityIndent = indent;
+                }
+            }
+
+            void Finish(uint64 end) {
+                CloseEntity(end);
+                CloseKey(end);
             }
+
+        private:
+            SceneFileIndex& m_Index;
+
+            std::string m_Key;
+            SceneFileIndex::Range m_KeyRange;
+            bool m_InEntity = false;
+            SceneFileIndex::EntityEntry m_Entry;
+            usize m_EntityIndent = 0;
+
+            void CloseKey(uint64 end) {
+                if (!m_Key.empty()) {
+                    m_KeyRange.End = end;
+                    m_Index.Keys[m_Key] = m_KeyRange;
+                    m_Key.clear();
+                }
+            }
+
+            void CloseEntity(uint64 end) {
+                if (m_InEntity) {
+                    m_Entry.Lines.End = end;
+                    m_Index.Entities.push_back(m_Entry);
+                    m_InEntity = false;
+                }
+            }
+        };
+    }
+
+    bool SceneSerializer::Deserialize(Ref<Scene>& scene) {
+        VANTA_PROFILE_FUNCTION();
+        using namespace TextScene;
+
+        // Index the text as it was read, rather than the file's bytes, so the ranges match it
+        const std::string text = m_File.Read();
+        SceneFileIndex index;
+        {
+            Indexer indexer(index);
+            usize pos = 0;
+            while (pos < text.size()) {
+                usize end = text.find('\n', pos);
+                end = (end == std::string::npos) ? text.size() : end;
+                indexer.Line(std::string_view(text).substr(pos, end - pos), pos);
+                pos = end + 1;
+            }
+            indexer.Finish(text.size());
         }
 
+        auto sceneKey = index.Keys.find("Scene");
+        if (sceneKey == index.Keys.end())
+            return false;
+
+        // The scene's own keys run up to its first entity
+        const SceneFileIndex::Range& sceneRange = sceneKey->second;
+        const uint64 headerEnd = index.Entities.empty() ? sceneRange.End : index.Entities.front().Lines.Begin;
+
+        YAML::Node data;
+        try {
+            data = YAML::Load(text.substr(sceneRange.Begin, headerEnd - sceneRange.Begin))["Scene"];
+        }
+        catch (YAML::ParserException e) {
+            VANTA_CORE_ERROR("Failed to parse scene file: {}; {}", m_File.Filepath, e.what());
+            return false;
+        }
+
+        if (!data)
+            return false;
+
+        std::string sceneName = data["Name"].as<std::string>();
+        VANTA_CORE_TRACE("Deserializing scene: {}", sceneName);
+
+        // UUID of active camera
+        auto activeCamera = data["ActiveCamera"];
+        UUID activeCameraUUID = activeCamera ? UUID(activeCamera.as<uint64>()) : UUID();
+
+        // Entity list
+        auto entities = data["Entities"];
+        if (!entities)
+            return false;
+
+        std::vector<EntityBatch> batches;
+        std::atomic<bool> failed = false;
+
+        if (entities.IsSequence() && entities.size() > 0) {
+            // Entities weren't written one per block, so they can't be split up; parse them in place
+            batches.resize(1);
+            try {
+                for (auto item : entities) {
+                    if (!ParseEntity(item, batches[0])) {
+                        failed = true;
+                        break;
+                    }
+                }
+            }
+            catch (YAML::Exception e) {
+                VANTA_CORE_ERROR("Failed to parse scene file: {}; {}", m_File.Filepath, e.what());
+                failed = true;
+            }
+        }
+        else {
+            // Parse and convert ranges of entities in parallel, each into its own batch
+            const usize count = index.Entities.size();
+            const usize chunkSize = detail::ParallelChunkSize(count);
+            const usize jobCount = (count + chunkSize - 1) / chunkSize;
+            batches.resize(jobCount);
+
+            auto parse = [&](usize job) {
+                const usize begin = job * chunkSize;
+                const usize end = std::min(count, begin + chunkSize);
+
+                EntityBatch& batch = batches[job];
+                batch.IDs.reserve(end - begin);
+                batch.Transforms.reserve(end - begin);
+
+                try {
+                    for (usize i = begin; i < end && !failed; i++) {
+                        const SceneFileIndex::Range& lines = index.Entities[i].Lines;
+                        if (!ParseEntity(std::string_view(text).substr(lines.Begin, lines.End - lines.Begin), batch))
+                            failed = true;
+                    }
+                }
+                catch (YAML::Exception e) {
+                    VANTA_CORE_ERROR("Failed to parse scene file: {}; {}", m_File.Filepath, e.what());
+                    failed = true;
+                }
+            };
+
+            if (jobCount == 1) {
+                parse(0);
+            }
+            else if (jobCount > 1) {
+                JobCounter counter;
+                Fibers::Dispatch(counter, jobCount, parse);
+                counter.Wait();
+            }
+        }
+
+        if (failed)
+            return false;
+
+        // Create every entity and add its components in bulk
+        std::vector<entt::entity> handles;
+        InsertEntities(scene, batches, handles);
+
+        // Check for active camera entity
+        if (Entity camera = scene->GetEntityByID(activeCameraUUID))
+            scene->SetActiveCameraEntity(camera);
+
         return true;
     }
+
+    Entity SceneSerializer::DeserializeEntity(Ref<Scene>& scene, UUID uuid) {
+        VANTA_PROFILE_FUNCTION();
+        using namespace TextScene;
+
+        const Opt<usize> entry = FindEntity(uuid);
+        if (!entry)
+            return Entity();
+
+        std::vector<EntityBatch> batches(1);
+        try {
+            if (!ParseEntity(ReadRange(GetIndex().Entities[*entry].Lines), batches[0]))
+                return Entity();
+        }
+        catch (YAML::Exception e) {
+            VANTA_CORE_ERROR("Failed to parse entity {} of scene file: {}; {}", uuid, m_File.Filepath, e.what());
+            return Entity();
+        }
+
+        std::vector<entt::entity> handles;
+        InsertEntities(scene, batches, handles);
+        return Entity(handles.front(), scene.get());
+    }
+
+    const SceneFileIndex& SceneSerializer::GetIndex() {
+        if (m_Index)
+            return *m_Index;
+
+        VANTA_PROFILE_FUNCTION();
+
+        m_Index = SceneFileIndex();
+
+        std::ifstream file(m_File.Filepath, std::ios::in | std::ios::binary);
+        if (!file)
+            return *m_Index;
+
+        TextScene::Indexer indexer(*m_Index);
+        std::string line;
+        uint64 offset = 0;
+        while (std::getline(file, line)) {
+            indexer.Line(line, offset);
+            offset += line.size() + 1;
+        }
+        indexer.Finish(offset);
+
+        return *m_Index;
+    }
+
+    Opt<std::string> SceneSerializer::ReadKey(const std::string& name) {
+        const auto& keys = GetIndex().Keys;
+        auto it = keys.find(name);
+        if (it == keys.end())
+            return None;
+        return ReadRange(it->second);
+    }
+
+    Opt<usize> SceneSerializer::FindEntity(UUID uuid) {
+        GetIndex();
+        SceneFileIndex& index = *m_Index;
+
+        // Only the `[Name, ID]` pairs are parsed, and only once something is looked up
+        if (!index.EntityLookup) {
+            VANTA_PROFILE_FUNCTION();
+
+            std::ifstream file(m_File.Filepath, std::ios::in | std::ios::binary);
+            if (!file)
+                return None;
+
+            std::unordered_map<UUID, usize> lookup;
+            lookup.reserve(index.Entities.size());
+
+            std::string header;
+            for (usize i = 0; i < index.Entities.size(); i++) {
+                const SceneFileIndex::Range& range = index.Entities[i].Header;
+                header.resize(range.End - range.Begin);
+                file.seekg(range.Begin);
+                file.read(header.data(), header.size());
+
+                try {
+                    YAML::Node id = YAML::Load(header);
+                    if (!id.IsSequence() || id.size() != 2) {
+                        VANTA_CORE_ERROR("Unreadable entity header in scene file: {}", m_File.Filepath);
+                        return None;
+                    }
+                    lookup[UUID(id[1].as<uint64>())] = i;
+                }
+                catch (YAML::Exception e) {
+                    VANTA_CORE_ERROR("Unreadable entity header in scene file: {}; {}", m_File.Filepath, e.what());
+                    return None;
+                }
+            }
+
+            index.EntityLookup = std::move(lookup);
+        }
+
+        auto it = index.EntityLookup->find(uuid);
+        if (it == index.EntityLookup->end())
+            return None;
+        return it->second;
+    }
+
+    std::string SceneSerializer::ReadRange(const SceneFileIndex::Range& range) const {
+        std::ifstream file(m_File.Filepath, std::ios::in | std::ios::binary);
+        if (!file || range.End <= range.Begin)
+            return std::string();
+
+        std::string text(range.End - range.Begin, '\0');
+        file.seekg(range.Begin);
+        file.read(text.data(), text.size());
+        text.resize(file.gcount());
+        return text;
+    }
+
+    bool SceneSerializer::Load(const Path& filepath, Ref<Scene>& scene) {
+        VANTA_PROFILE_FUNCTION();
+
+        if (BinarySceneSerializer::IsBinary(filepath))
+            return BinarySceneSerializer(filepath).Deserialize(scene);
+
+        // Prefer the binary form, unless the text has been edited since it was exported
+        const Path binaryPath = BinarySceneSerializer::GetBinaryPath(filepath);
+        std::error_code error;
+        const auto binaryTime = std::filesystem::last_write_time(binaryPath, error);
+        if (!error && binaryTime >= std::filesystem::last_write_time(filepath, error) && !error) {
+            if (BinarySceneSerializer(binaryPath).Deserialize(scene))
+                return true;
+
+            VANTA_CORE_WARN("Falling back to text scene: {}", filepath);
+            scene = NewRef<Scene>();
+        }
+
+        return SceneSerializer(filepath).Deserialize(scene);
+    }
 }
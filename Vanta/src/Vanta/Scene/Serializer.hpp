@@ -1,17 +1,61 @@
 #pragma once
+#include "Vanta/Scene/Entity.hpp"
 #include "Vanta/Scene/Scene.hpp"
 #include "Vanta/Util/SerializerUtils.hpp"
 
 namespace Vanta {
 
+    /// <summary>
+    /// Where the top-level keys and the entities of a scene file are,
+    /// so single items can be read without parsing the whole file.
+    /// </summary>
+    struct SceneFileIndex {
+        struct Range {
+            uint64 Begin = 0;   ///< Byte offset of the first line
+            uint64 End = 0;     ///< Byte offset past the last line
+        };
+
+        struct EntityEntry {
+            Range Lines;
+            Range Header;   ///< The `[Name, ID]` pair of the entity's first line
+        };
+
+        std::unordered_map<std::string, Range> Keys;
+        std::vector<EntityEntry> Entities;                      ///< In file order
+        Opt<std::unordered_map<UUID, usize>> EntityLookup;      ///< Index into `Entities`, built by the first lookup
+    };
+
     class SceneSerializer {
     public:
         SceneSerializer() = default;
         SceneSerializer(const IO::File& file);
 
+        /// <summary>
+        /// Write a scene to the file. Entities are written out as they're emitted,
+        /// so the document is never held in memory as a whole.
+        /// The file is only replaced once the scene has been written in full.
+        /// </summary>
         void Serialize(const Ref<Scene>& scene);
+
+        /// <summary>
+        /// Add every entity of the file to a scene.
+        /// Ranges of entities are parsed in parallel, each into per-component arrays,
+        /// which are then added to the scene in bulk on the calling thread.
+        /// </summary>
         bool Deserialize(Ref<Scene>& scene);
 
+        /// <summary>
+        /// Add a single entity of the file to a scene, without parsing the rest of the file.
+        /// Returns an invalid entity if the file has no entity with the given ID.
+        /// </summary>
+        Entity DeserializeEntity(Ref<Scene>& scene, UUID uuid);
+
+        /// <summary>
+        /// Load a scene to run it.
+        /// A text scene is loaded from its binary form instead, if there's one next to it that's up to date.
+        /// </summary>
+        static bool Load(const Path& filepath, Ref<Scene>& scene);
+
         template<typename T>
         void Append(const std::string& name, const T& item) {
             YAML::Emitter out;
@@ -20,21 +64,37 @@ namespace Vanta {
             out << YAML::Key << name << YAML::Value << item;
             out << YAML::EndMap;
             m_File.Append(out.c_str());
+            m_Index = None;
         }
 
+        /// <summary>
+        /// Read a top-level key of the file.
+        /// Only the key's own lines are parsed.
+        /// </summary>
         template<typename T>
         Opt<T> Get(const std::string& name) {
-            std::string text = m_File.Read();
-            YAML::Node data = YAML::Load(text);
+            Opt<std::string> text = ReadKey(name);
+            if (!text)
+                return None;
 
-            auto node = data[name];
+            auto node = YAML::Load(*text)[name];
             if (!node)
                 return None;
-            
+
             return node.as<T>();
         }
 
+        /// <summary>
+        /// Index of the file, built in a single pass over its lines the first time it's needed.
+        /// </summary>
+        const SceneFileIndex& GetIndex();
+
     private:
         IO::File m_File;
+        Opt<SceneFileIndex> m_Index;
+
+        Opt<std::string> ReadKey(const std::string& name);
+        Opt<usize> FindEntity(UUID uuid);
+        std::string ReadRange(const SceneFileIndex::Range& range) const;
     };
 }
@@ -0,0 +1,228 @@
+#include "vantapch.hpp"
+#include "Vanta/Scene/StaticSpriteCache.hpp"
+
+namespace Vanta {
+
+    // Interleave the bits of a cell's coordinates, so nearby cells sort close together
+    static uint64 SpreadBits(uint32 value) {
+        uint64 x = value;
+        x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+        x = (x | (x << 8))  & 0x00ff00ff00ff00ffull;
+        x = (x | (x << 4))  & 0x0f0f0f0f0f0f0f0full;
+        x = (x | (x << 2))  & 0x3333333333333333ull;
+        x = (x | (x << 1))  & 0x5555555555555555ull;
+        return x;
+    }
+
+    static uint64 CellOrder(const glm::vec3& position) {
+        // Biased, so negative cells sort before positive ones
+        auto cell = [](float coord) {
+            const float index = std::clamp(std::floor(coord / StaticSpriteCache::CELL_SIZE), -2147483648.f, 2147483520.f);
+            return (uint32)((int64)index + 0x80000000ll);
+        };
+        return SpreadBits(cell(position.x)) | (SpreadBits(cell(position.y)) << 1);
+    }
+
+    void StaticSpriteCache::Connect(entt::registry& registry) {
+        registry.on_construct<SpriteComponent>().connect<&StaticSpriteCache::OnSpriteAdded>(*this);
+        registry.on_destroy<SpriteComponent>().connect<&StaticSpriteCache::OnSpriteRemoved>(*this);
+        registry.on_destroy<TransformComponent>().connect<&StaticSpriteCache::OnRenderStateChanged>(*this);
+        registry.on_construct<Rigidbody2DComponent>().connect<&StaticSpriteCache::OnRenderStateChanged>(*this);
+    }
+
+    void StaticSpriteCache::Disconnect(entt::registry& registry) {
+        registry.on_construct<SpriteComponent>().disconnect(this);
+        registry.on_destroy<SpriteComponent>().disconnect(this);
+        registry.on_destroy<TransformComponent>().disconnect(this);
+        registry.on_construct<Rigidbody2DComponent>().disconnect(this);
+    }
+
+    bool StaticSpriteCache::Update(Record& record, const TransformComponent& tr, const SpriteComponent& sprite, uint32& chunk) {
+        const Texture2D* texture = sprite.Texture.get();
+        const uint32 textureRevision = texture ? texture->GetRevision() : 0;
+
+        if (record.TransformVersion == tr.GetVersion()
+            && record.Texture == texture
+            && record.TextureRevision == textureRevision
+            && record.Color == sprite.Color
+            && record.TilingFactor == sprite.TilingFactor)
+        {
+            if (record.StableFrames < SETTLE_FRAMES)
+                record.StableFrames++;
+            return false;
+        }
+
+        record.TransformVersion = tr.GetVersion();
+        record.Texture = texture;
+        record.TextureRevision = textureRevision;
+        record.Color = sprite.Color;
+        record.TilingFactor = sprite.TilingFactor;
+        record.StableFrames = 0;
+
+        chunk = record.Chunk;
+        record.Chunk = NO_CHUNK;
+        return true;
+    }
+
+    void StaticSpriteCache::Rebuild(entt::registry& registry) {
+        if (m_DirtyChunks.empty() && m_Pending.empty())
+            return;
+
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        // Sprites left in dirty chunks haven't changed, so they're baked again along with the settled ones
+        std::sort(m_DirtyChunks.begin(), m_DirtyChunks.end());
+        m_DirtyChunks.erase(std::unique(m_DirtyChunks.begin(), m_DirtyChunks.end()), m_DirtyChunks.end());
+
+        for (uint32 index : m_DirtyChunks) {
+            for (entt::entity entity : m_Chunks[index].Entities) {
+                if (m_Records.contains(entity) && m_Records.get(entity).Chunk == index)
+                    m_Pending.push_back(entity);
+            }
+            FreeChunk(index);
+        }
+        m_DirtyChunks.clear();
+
+        auto& transforms = registry.storage<TransformComponent>();
+        auto& sprites = registry.storage<SpriteComponent>();
+
+        m_Ordered.clear();
+        for (entt::entity entity : m_Pending) {
+            if (transforms.contains(entity) && sprites.contains(entity))
+                m_Ordered.emplace_back(CellOrder(transforms.get(entity).GetPosition()), entity);
+        }
+        m_Pending.clear();
+
+        std::sort(m_Ordered.begin(), m_Ordered.end());
+
+        // Under-filled chunks in the same cells are baked again along with the new sprites
+        const usize pendingCount = m_Ordered.size();
+        for (uint32 index = 0; index < (uint32)m_Chunks.size() && pendingCount > 0; index++) {
+            const Chunk& chunk = m_Chunks[index];
+            if (chunk.Batch.IsEmpty() || chunk.Batch.Size() >= MERGE_SIZE)
+                continue;
+
+            auto first = std::lower_bound(m_Ordered.begin(), m_Ordered.begin() + pendingCount, chunk.FirstCell,
+                [](const auto& item, uint64 cell) { return item.first < cell; });
+            if (first == m_Ordered.begin() + pendingCount || first->first > chunk.LastCell)
+                continue;
+
+            for (entt::entity entity : chunk.Entities) {
+                if (m_Records.contains(entity) && m_Records.get(entity).Chunk == index && transforms.contains(entity) && sprites.contains(entity))
+                    m_Ordered.emplace_back(CellOrder(transforms.get(entity).GetPosition()), entity);
+            }
+            FreeChunk(index);
+        }
+
+        if (m_Ordered.size() > pendingCount)
+            std::sort(m_Ordered.begin(), m_Ordered.end());
+
+        for (usize begin = 0; begin < m_Ordered.size(); begin += CHUNK_SIZE) {
+            const usize end = std::min(m_Ordered.size(), begin + CHUNK_SIZE);
+
+            m_Quads.Clear();
+            m_Bounds.clear();
+            for (usize i = begin; i < end; i++) {
+                const entt::entity entity = m_Ordered[i].second;
+                const glm::mat4& transform = transforms.get(entity).GetTransform();
+                m_Quads.AddSprite(transform, sprites.get(entity), (uint32)entity);
+                m_Bounds.push_back(BoundingBox::FromQuad(transform));
+            }
+
+            // A chunk may run out of texture slots before taking every sprite
+            for (usize first = 0; first < m_Quads.Size();) {
+                const uint32 index = AllocateChunk();
+                Chunk& chunk = m_Chunks[index];
+
+                const usize baked = Renderer2D::BakeQuads(m_Quads, first, chunk.Batch);
+                VANTA_CORE_ASSERT(baked > 0, "Failed to bake any sprites!");
+
+                glm::vec3 min = m_Bounds[first].Center - m_Bounds[first].Extents;
+                glm::vec3 max = m_Bounds[first].Center + m_Bounds[first].Extents;
+                for (usize i = first; i < first + baked; i++) {
+                    const entt::entity entity = m_Ordered[begin + i].second;
+                    chunk.Entities.push_back(entity);
+                    m_Records.get(entity).Chunk = index;
+
+                    min = glm::min(min, m_Bounds[i].Center - m_Bounds[i].Extents);
+                    max = glm::max(max, m_Bounds[i].Center + m_Bounds[i].Extents);
+                }
+                chunk.Bounds = { (min + max) * 0.5f, (max - min) * 0.5f };
+                chunk.FirstCell = m_Ordered[begin + first].first;
+                chunk.LastCell = m_Ordered[begin + first + baked - 1].first;
+
+                m_SpriteCount += baked;
+                first += baked;
+            }
+        }
+    }
+
+    void StaticSpriteCache::Draw(const Frustum& frustum) {
+        VANTA_PROFILE_RENDER_FUNCTION();
+
+        usize visible = 0;
+        usize culled = 0;
+        m_Visible.clear();
+        for (const Chunk& chunk : m_Chunks) {
+            if (chunk.Batch.IsEmpty())
+                continue;
+
+            if (frustum.Intersects(chunk.Bounds)) {
+                m_Visible.push_back(&chunk.Batch);
+                visible += chunk.Batch.Size();
+            }
+            else {
+                culled += chunk.Batch.Size();
+            }
+        }
+
+        if (!m_Visible.empty())
+            Renderer2D::DrawQuads(m_Visible);
+        Renderer2D::RecordCulling(visible, culled);
+    }
+
+    void StaticSpriteCache::Invalidate(entt::entity entity) {
+        if (!m_Records.contains(entity))
+            return;
+
+        Record& record = m_Records.get(entity);
+        if (record.Chunk != NO_CHUNK)
+            m_DirtyChunks.push_back(record.Chunk);
+
+        record.Chunk = NO_CHUNK;
+        record.StableFrames = 0;
+    }
+
+    uint32 StaticSpriteCache::AllocateChunk() {
+        if (!m_FreeChunks.empty()) {
+            const uint32 index = m_FreeChunks.back();
+            m_FreeChunks.pop_back();
+            return index;
+        }
+
+        m_Chunks.emplace_back();
+        return (uint32)m_Chunks.size() - 1;
+    }
+
+    void StaticSpriteCache::FreeChunk(uint32 index) {
+        Chunk& chunk = m_Chunks[index];
+        m_SpriteCount -= chunk.Batch.Size();
+        chunk = Chunk();
+        m_FreeChunks.push_back(index);
+    }
+
+    void StaticSpriteCache::OnSpriteAdded(entt::registry&, entt::entity entity) {
+        if (!m_Records.contains(entity))
+            m_Records.emplace(entity);
+    }
+
+    void StaticSpriteCache::OnSpriteRemoved(entt::registry&, entt::entity entity) {
+        Invalidate(entity);
+        if (m_Records.contains(entity))
+            m_Records.erase(entity);
+    }
+
+    void StaticSpriteCache::OnRenderStateChanged(entt::registry&, entt::entity entity) {
+        Invalidate(entity);
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include "Vanta/Scene/Components.hpp"
+#include "Vanta/Render/Frustum.hpp"
+#include "Vanta/Render/Renderer2D.hpp"
+
+#include <entt/entt.hpp>
+
+namespace Vanta {
+
+    /// <summary>
+    /// Sprites that haven't changed in a while, baked into chunks that are drawn in a single call each.
+    ///
+    /// Every sprite keeps a record of the state it was last drawn in: its transform's version,
+    /// which every `TransformComponent` setter increments, and its sprite data.
+    /// Sprites that stay unchanged for `SETTLE_FRAMES`, are opaque and have no rigidbody
+    /// are handed over to the cache and baked with their neighbours.
+    /// Once a cached sprite changes, or is removed, its chunk is rebuilt without it,
+    /// and it's drawn dynamically until it settles again.
+    ///
+    /// Only opaque sprites are cached, since they're depth tested and so don't need to be
+    /// drawn in order with the rest of the scene.
+    /// </summary>
+    class StaticSpriteCache {
+    public:
+        static constexpr uint32 SETTLE_FRAMES = 8;   ///< Frames a sprite must stay unchanged before it's cached
+        static constexpr usize CHUNK_SIZE = 1024;    ///< Most sprites baked into one chunk
+        static constexpr usize MERGE_SIZE = CHUNK_SIZE / 4; ///< Chunks with fewer sprites are baked again with new sprites in their cells
+        static constexpr float CELL_SIZE = 32.f;     ///< Sprites are baked in order of the cells they're in, so chunks stay compact and cull well
+        static constexpr uint32 NO_CHUNK = std::numeric_limits<uint32>::max();
+
+        /// <summary>
+        /// State of a sprite as it was last drawn.
+        /// </summary>
+        struct Record {
+            uint32 TransformVersion = std::numeric_limits<uint32>::max();
+            const Texture2D* Texture = nullptr;
+            uint32 TextureRevision = 0;
+            glm::vec4 Color = glm::vec4(0.f);
+            float TilingFactor = 0.f;
+
+            uint32 StableFrames = 0; // Frames since the sprite last changed
+            uint32 Chunk = NO_CHUNK; // Chunk the sprite is baked into, if any
+        };
+
+        StaticSpriteCache() = default;
+        StaticSpriteCache(const StaticSpriteCache&) = delete;
+        StaticSpriteCache& operator=(const StaticSpriteCache&) = delete;
+
+        /// <summary>
+        /// Track sprites being added to and removed from a registry.
+        /// </summary>
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /// <summary>
+        /// Record of a sprite. Every entity with a sprite has one.
+        /// Records of different entities may be used from different threads.
+        /// </summary>
+        Record& GetRecord(entt::entity entity) { return m_Records.get(entity); }
+
+        /// <summary>
+        /// Compare a sprite against its record, updating the record.
+        /// Returns whether the sprite changed since it was last seen.
+        /// If it did, the chunk it was in is returned in `chunk`, and the sprite is no longer cached.
+        /// </summary>
+        static bool Update(Record& record, const TransformComponent& tr, const SpriteComponent& sprite, uint32& chunk);
+
+        /// <summary>
+        /// Whether a sprite has stayed unchanged long enough to be cached.
+        /// </summary>
+        static bool IsSettled(const Record& record) { return record.StableFrames >= SETTLE_FRAMES; }
+
+        /// <summary>
+        /// Have a chunk rebuilt, after one of its sprites changed.
+        /// </summary>
+        void MarkDirty(uint32 chunk) { m_DirtyChunks.push_back(chunk); }
+
+        /// <summary>
+        /// Have a settled sprite baked into a chunk.
+        /// </summary>
+        void MarkSettled(entt::entity entity) { m_Pending.push_back(entity); }
+
+        /// <summary>
+        /// Rebuild dirty chunks, and bake settled sprites into chunks.
+        /// Under-filled chunks covering the cells of those sprites are merged with them,
+        /// so sprites settling a few at a time don't leave a trail of small chunks.
+        /// </summary>
+        void Rebuild(entt::registry& registry);
+
+        /// <summary>
+        /// Draw every chunk in view, as a single submission.
+        /// </summary>
+        void Draw(const Frustum& frustum);
+
+        usize GetChunkCount() const { return m_Chunks.size() - m_FreeChunks.size(); }
+        usize GetSpriteCount() const { return m_SpriteCount; }
+
+    private:
+        struct Chunk {
+            StaticQuadBatch Batch;
+            BoundingBox Bounds;
+            std::vector<entt::entity> Entities;
+            uint64 FirstCell = 0; // Cell order of the chunk's first and last sprites
+            uint64 LastCell = 0;
+        };
+
+        entt::storage<Record> m_Records;
+        std::vector<Chunk> m_Chunks;
+        std::vector<uint32> m_FreeChunks;
+        usize m_SpriteCount = 0;
+
+        // Work for the next rebuild, and scratch storage reused between rebuilds
+        std::vector<uint32> m_DirtyChunks;
+        std::vector<entt::entity> m_Pending;
+        std::vector<std::pair<uint64, entt::entity>> m_Ordered;
+        std::vector<BoundingBox> m_Bounds;
+        QuadList m_Quads;
+        std::vector<const StaticQuadBatch*> m_Visible;
+
+        void Invalidate(entt::entity entity);
+        uint32 AllocateChunk();
+        void FreeChunk(uint32 index);
+
+        void OnSpriteAdded(entt::registry& registry, entt::entity entity);
+        void OnSpriteRemoved(entt::registry& registry, entt::entity entity);
+        void OnRenderStateChanged(entt::registry& registry, entt::entity entity);
+    };
+}
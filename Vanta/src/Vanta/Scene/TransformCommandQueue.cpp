@@ -9,23 +9,82 @@ namespace Vanta {
     // ---------------------------------------------------------------------------
 
     void TransformCommandQueue::Enqueue(const SetPositionCommand& cmd) {
-        m_SetPosition.push_back(cmd);
-        ++m_Diagnostics.Enqueued;
+        Stage(&PhaseCommands::SetPosition, cmd);
     }
 
     void TransformCommandQueue::Enqueue(const SetRotationCommand& cmd) {
-        m_SetRotation.push_back(cmd);
-        ++m_Diagnostics.Enqueued;
+        Stage(&PhaseCommands::SetRotation, cmd);
     }
 
     void TransformCommandQueue::Enqueue(const SetScaleCommand& cmd) {
-        m_SetScale.push_back(cmd);
-        ++m_Diagnostics.Enqueued;
+        Stage(&PhaseCommands::SetScale, cmd);
     }
 
     void TransformCommandQueue::Enqueue(const SetTransformCommand& cmd) {
-        m_SetTransform.push_back(cmd);
-        ++m_Diagnostics.Enqueued;
+        Stage(&PhaseCommands::SetTransform, cmd);
+    }
+
+    TransformCommandQueue::StagingBuffer& TransformCommandQueue::ActivateStaging(usize slot) {
+        auto& staging = m_Staging[slot];
+
+        // Only the first command of a thread since the last merge touches shared state
+        const uint64_t producer = CommandProducerID();
+        if (!staging.Active) {
+            staging.Active = true;
+            staging.Producer = producer;
+            m_ActiveProducers.fetch_or(uint64_t(1) << slot, std::memory_order_release);
+        }
+        else if (staging.Producer != producer) {
+            // The slot was given back by an exited thread, or is the shared one
+            staging.Mixed = true;
+        }
+
+        return staging;
+    }
+
+    void TransformCommandQueue::MergeStaging() {
+        uint64_t active = m_ActiveProducers.exchange(0, std::memory_order_acquire);
+        if (active == 0)
+            return;
+
+        bool multipleProducers = (active & (active - 1)) != 0;
+        ForEachCommandProducer(active, [&](usize slot) { multipleProducers |= m_Staging[slot].Mixed; });
+
+        for (usize phase = 0; phase < COMMAND_PHASE_COUNT; phase++) {
+            auto& commands = m_Phases[phase];
+            const usize firstPosition  = commands.SetPosition.size();
+            const usize firstRotation  = commands.SetRotation.size();
+            const usize firstScale     = commands.SetScale.size();
+            const usize firstTransform = commands.SetTransform.size();
+
+            ForEachCommandProducer(active, [&](usize slot) {
+                auto& staged = m_Staging[slot].Phases[phase];
+                MergeStagedCommands(commands.SetPosition,  staged.SetPosition);
+                MergeStagedCommands(commands.SetRotation,  staged.SetRotation);
+                MergeStagedCommands(commands.SetScale,     staged.SetScale);
+                MergeStagedCommands(commands.SetTransform, staged.SetTransform);
+            });
+
+            // Slot assignment depends on which worker ran which job,
+            // so order commands from several producers by entity, source and sequence instead
+            if (multipleProducers) {
+                SortCommandsByEntity(commands.SetPosition,  firstPosition);
+                SortCommandsByEntity(commands.SetRotation,  firstRotation);
+                SortCommandsByEntity(commands.SetScale,     firstScale);
+                SortCommandsByEntity(commands.SetTransform, firstTransform);
+            }
+        }
+
+        ForEachCommandProducer(active, [&](usize slot) {
+            auto& staging = m_Staging[slot];
+            m_Diagnostics.Enqueued += staging.Enqueued;
+            staging.Enqueued = 0;
+            staging.Active = false;
+            staging.Mixed = false;
+        });
+
+        // Merged commands are already in order, only the ones staged from here on are sorted again
+        m_NextSequence.store(0, std::memory_order_relaxed);
     }
 
     // ---------------------------------------------------------------------------
@@ -33,17 +92,141 @@ namespace Vanta {
     // ---------------------------------------------------------------------------
 
     void TransformCommandQueue::Apply(entt::registry& registry, CommandPhase phase) {
-        ApplyPositions (registry, phase);
-        ApplyRotations (registry, phase);
-        ApplyScales    (registry, phase);
-        ApplyTransforms(registry, phase);
+        MergeStaging();
+
+        auto& commands = m_Phases[PhaseIndex(phase)];
+        if (m_ApplyMode == CommandApplyMode::Coalesced) {
+            ApplyCoalesced(registry, commands);
+        }
+        else {
+            ApplyPositions (registry, commands.SetPosition);
+            ApplyRotations (registry, commands.SetRotation);
+            ApplyScales    (registry, commands.SetScale);
+            ApplyTransforms(registry, commands.SetTransform);
+        }
+        commands.Clear();
+    }
+
+    TransformCommandQueue::CoalescedTransform* TransformCommandQueue::Coalesce(entt::entity entity) {
+        if (entity == entt::null) {
+            ++m_Diagnostics.Dropped;
+            return nullptr;
+        }
+
+        const usize index = entt::to_entity(entity);
+        if (index >= m_CoalesceSlots.size())
+            m_CoalesceSlots.resize(index + 1, INVALID_COALESCE_SLOT);
+
+        // A different version in the same slot is a recycled entity; track it separately
+        uint32_t& slot = m_CoalesceSlots[index];
+        if (slot == INVALID_COALESCE_SLOT || m_Coalesced[slot].Entity != entity) {
+            slot = (uint32_t)m_Coalesced.size();
+            m_Coalesced.push_back(CoalescedTransform{ .Entity = entity });
+        }
+
+        auto& pending = m_Coalesced[slot];
+        ++pending.CommandCount;
+        return &pending;
     }
 
-    void TransformCommandQueue::ApplyPositions(entt::registry& registry, CommandPhase phase) {
-        for (const auto& cmd : m_SetPosition) {
-            if (cmd.Phase != phase)
+    void TransformCommandQueue::ApplyCoalesced(entt::registry& registry, const PhaseCommands& commands) {
+        VANTA_PROFILE_FUNCTION();
+        m_Coalesced.clear();
+
+        // Same precedence as applying in order: field commands first, then full transforms
+        for (const auto& cmd : commands.SetPosition) {
+            if (auto* pending = Coalesce(cmd.Entity)) {
+                pending->Position = cmd.Position;
+                pending->Fields |= CoalescedTransform::POSITION;
+            }
+        }
+        for (const auto& cmd : commands.SetRotation) {
+            if (auto* pending = Coalesce(cmd.Entity)) {
+                pending->RotationRad = cmd.RotationRad;
+                pending->Fields |= CoalescedTransform::ROTATION;
+            }
+        }
+        for (const auto& cmd : commands.SetScale) {
+            if (auto* pending = Coalesce(cmd.Entity)) {
+                pending->Scale = cmd.Scale;
+                pending->Fields |= CoalescedTransform::SCALE;
+            }
+        }
+        for (const auto& cmd : commands.SetTransform) {
+            if (auto* pending = Coalesce(cmd.Entity)) {
+                pending->Position = cmd.Position;
+                pending->RotationRad = cmd.RotationRad;
+                pending->Scale = cmd.Scale;
+                pending->Fields = CoalescedTransform::POSITION | CoalescedTransform::ROTATION | CoalescedTransform::SCALE;
+            }
+        }
+
+        // Write in entity index order to walk component storage sequentially
+        std::sort(m_Coalesced.begin(), m_Coalesced.end(), [](const auto& a, const auto& b) {
+            return entt::to_integral(a.Entity) < entt::to_integral(b.Entity);
+        });
+
+        for (const auto& pending : m_Coalesced)
+            m_CoalesceSlots[entt::to_entity(pending.Entity)] = INVALID_COALESCE_SLOT;
+
+        // Fetch storage up front, so workers never touch the registry's pool map
+        auto& transforms = registry.storage<TransformComponent>();
+
+        const usize count = m_Coalesced.size();
+        const usize jobCount = std::min<usize>(Fibers::THREAD_COUNT, count / PARALLEL_APPLY_MIN_ENTITIES);
+
+        if (jobCount > 1) {
+            // Every entity has a single write, so disjoint ranges never touch the same component
+            const usize chunkSize = (count + jobCount - 1) / jobCount;
+            m_JobDiagnostics.assign(jobCount, CommandQueueDiagnostics());
+
+            auto job = [&](usize i) {
+                const usize begin = i * chunkSize;
+                const usize end = std::min(count, begin + chunkSize);
+                WriteCoalesced(transforms, begin, end, m_JobDiagnostics[i]);
+            };
+
+            JobCounter counter;
+            Fibers::Dispatch(counter, jobCount, job);
+            counter.Wait();
+
+            for (const auto& diagnostics : m_JobDiagnostics) {
+                m_Diagnostics.Applied   += diagnostics.Applied;
+                m_Diagnostics.Dropped   += diagnostics.Dropped;
+                m_Diagnostics.Coalesced += diagnostics.Coalesced;
+            }
+        }
+        else {
+            WriteCoalesced(transforms, 0, count, m_Diagnostics);
+        }
+    }
+
+    void TransformCommandQueue::WriteCoalesced(entt::storage_for_t<TransformComponent>& transforms, usize begin, usize end,
+                                               CommandQueueDiagnostics& diagnostics) const
+    {
+        for (usize i = begin; i < end; i++) {
+            const auto& pending = m_Coalesced[i];
+
+            if (!transforms.contains(pending.Entity)) {
+                diagnostics.Dropped += pending.CommandCount;
+                VANTA_CORE_WARN("TransformCommandQueue: {} command(s) dropped — entity {:x} has no TransformComponent",
+                    pending.CommandCount, (uint32_t)pending.Entity);
                 continue;
+            }
+
+            auto& tc = transforms.get(pending.Entity);
+            tc.SetTransformRad(
+                (pending.Fields & CoalescedTransform::POSITION) ? pending.Position    : tc.GetPosition(),
+                (pending.Fields & CoalescedTransform::ROTATION) ? pending.RotationRad : tc.GetRotationRadians(),
+                (pending.Fields & CoalescedTransform::SCALE)    ? pending.Scale       : tc.GetScale());
 
+            ++diagnostics.Applied;
+            diagnostics.Coalesced += pending.CommandCount - 1;
+        }
+    }
+
+    void TransformCommandQueue::ApplyPositions(entt::registry& registry, const std::vector<SetPositionCommand>& commands) {
+        for (const auto& cmd : commands) {
             auto* tc = registry.try_get<TransformComponent>(cmd.Entity);
             if (!tc) {
                 ++m_Diagnostics.Dropped;
@@ -55,14 +238,10 @@ namespace Vanta {
             tc->SetPosition(cmd.Position);
             ++m_Diagnostics.Applied;
         }
-        EraseCommandsForPhase(m_SetPosition, phase);
     }
 
-    void TransformCommandQueue::ApplyRotations(entt::registry& registry, CommandPhase phase) {
-        for (const auto& cmd : m_SetRotation) {
-            if (cmd.Phase != phase)
-                continue;
-
+    void TransformCommandQueue::ApplyRotations(entt::registry& registry, const std::vector<SetRotationCommand>& commands) {
+        for (const auto& cmd : commands) {
             auto* tc = registry.try_get<TransformComponent>(cmd.Entity);
             if (!tc) {
                 ++m_Diagnostics.Dropped;
@@ -74,14 +253,10 @@ namespace Vanta {
             tc->SetRotationRad(cmd.RotationRad);
             ++m_Diagnostics.Applied;
         }
-        EraseCommandsForPhase(m_SetRotation, phase);
     }
 
-    void TransformCommandQueue::ApplyScales(entt::registry& registry, CommandPhase phase) {
-        for (const auto& cmd : m_SetScale) {
-            if (cmd.Phase != phase)
-                continue;
-
+    void TransformCommandQueue::ApplyScales(entt::registry& registry, const std::vector<SetScaleCommand>& commands) {
+        for (const auto& cmd : commands) {
             auto* tc = registry.try_get<TransformComponent>(cmd.Entity);
             if (!tc) {
                 ++m_Diagnostics.Dropped;
@@ -93,14 +268,10 @@ namespace Vanta {
             tc->SetScale(cmd.Scale);
             ++m_Diagnostics.Applied;
         }
-        EraseCommandsForPhase(m_SetScale, phase);
     }
 
-    void TransformCommandQueue::ApplyTransforms(entt::registry& registry, CommandPhase phase) {
-        for (const auto& cmd : m_SetTransform) {
-            if (cmd.Phase != phase)
-                continue;
-
+    void TransformCommandQueue::ApplyTransforms(entt::registry& registry, const std::vector<SetTransformCommand>& commands) {
+        for (const auto& cmd : commands) {
             auto* tc = registry.try_get<TransformComponent>(cmd.Entity);
             if (!tc) {
                 ++m_Diagnostics.Dropped;
@@ -112,7 +283,6 @@ namespace Vanta {
             tc->SetTransformRad(cmd.Position, cmd.RotationRad, cmd.Scale);
             ++m_Diagnostics.Applied;
         }
-        EraseCommandsForPhase(m_SetTransform, phase);
     }
 
     // ---------------------------------------------------------------------------
@@ -120,10 +290,9 @@ namespace Vanta {
     // ---------------------------------------------------------------------------
 
     void TransformCommandQueue::Flush() {
-        m_SetPosition.clear();
-        m_SetRotation.clear();
-        m_SetScale.clear();
-        m_SetTransform.clear();
+        MergeStaging();
+        for (auto& commands : m_Phases)
+            commands.Clear();
     }
 
     // ---------------------------------------------------------------------------
@@ -131,17 +300,36 @@ namespace Vanta {
     // ---------------------------------------------------------------------------
 
     usize TransformCommandQueue::PendingCount() const {
-        return m_SetPosition.size()
-             + m_SetRotation.size()
-             + m_SetScale.size()
-             + m_SetTransform.size();
+        usize count = 0;
+        for (usize phase = 0; phase < COMMAND_PHASE_COUNT; phase++)
+            count += PendingCount(static_cast<CommandPhase>(phase));
+        return count;
     }
 
     usize TransformCommandQueue::PendingCount(CommandPhase phase) const {
-        return PendingCountForPhase(m_SetPosition, phase)
-             + PendingCountForPhase(m_SetRotation, phase)
-             + PendingCountForPhase(m_SetScale, phase)
-             + PendingCountForPhase(m_SetTransform, phase);
+        usize count = m_Phases[PhaseIndex(phase)].Size();
+        ForEachActiveStaging([&](const StagingBuffer& staging) {
+            count += staging.Phases[PhaseIndex(phase)].Size();
+        });
+        return count;
+    }
+
+    // ---------------------------------------------------------------------------
+    // Diagnostics
+    // ---------------------------------------------------------------------------
+
+    CommandQueueDiagnostics TransformCommandQueue::GetDiagnostics() const {
+        CommandQueueDiagnostics diagnostics = m_Diagnostics;
+        ForEachActiveStaging([&](const StagingBuffer& staging) {
+            diagnostics.Enqueued += staging.Enqueued;
+        });
+        return diagnostics;
+    }
+
+    void TransformCommandQueue::ResetDiagnostics() {
+        m_Diagnostics.Reset();
+        for (auto& staging : m_Staging)
+            staging.Enqueued = 0;
     }
 
 } // namespace Vanta
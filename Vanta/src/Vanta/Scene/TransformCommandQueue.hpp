@@ -3,6 +3,9 @@
 #include "Vanta/Scene/Components/TransformComponent.hpp"
 
 #include <entt/entt.hpp>
+#include <array>
+#include <limits>
+#include <mutex>
 #include <vector>
 
 namespace Vanta {
@@ -50,13 +53,30 @@ namespace Vanta {
     /// that every system always reads committed, consistent component state.
     ///
     /// Thread-safety:
-    ///   Enqueue is designed to be called from multiple producer threads via
-    ///   thread-local staging buffers.  Apply must only be called on the
-    ///   scene's owning thread.
+    ///   Enqueue may be called concurrently from any number of producer threads.
+    ///   Up to MAX_COMMAND_PRODUCERS live threads each write into their own staging
+    ///   buffer and take no locks; any further threads share one buffer behind a
+    ///   lock.  Slots are given back when threads exit.  Staged commands are merged into
+    ///   the queue by Apply, Flush and the inspection helpers, which must only be
+    ///   called on the scene's owning thread while no producers are running.
+    ///   When more than one thread produced commands, the merged commands are
+    ///   ordered by entity, source and the sequence stamped when each command
+    ///   was staged, so a write that happens after another wins regardless of
+    ///   which slots the threads were given.
     ///
     /// Conflict resolution:
     ///   Within a phase, commands targeting the same entity and field are
-    ///   resolved last-writer-wins in stable insertion order.
+    ///   resolved last-writer-wins in stable insertion order.  Full transform
+    ///   commands take precedence over single field commands.
+    ///
+    ///   In Coalesced mode (the default) this is resolved before touching any
+    ///   components: every entity gets a single SetTransformRad, and entities
+    ///   are written in ascending index order so component storage is walked
+    ///   in cache order.  InOrder mode writes every command in turn.
+    ///
+    ///   Since coalescing leaves exactly one write per entity, large coalesced
+    ///   batches are split into disjoint entity ranges and written in parallel
+    ///   on the fiber pool.
     ///
     /// Extensibility:
     ///   To support a new transform field, add a typed command struct above
@@ -81,6 +101,33 @@ namespace Vanta {
         void Enqueue(const SetScaleCommand&     cmd);
         void Enqueue(const SetTransformCommand& cmd);
 
+        /// Enqueue up to `count` full transform commands, written in place into
+        /// the calling thread's staging buffer.  For producers that emit many
+        /// commands at once, like physics writeback.
+        ///
+        /// `fill(SetTransformCommand* out)` writes the commands and returns how
+        /// many it wrote.  It must not enqueue into this queue or yield its fiber,
+        /// since either could hand the staging buffer to someone else meanwhile.
+        template<typename Fill>
+        usize EnqueueTransforms(CommandPhase phase, usize count, Fill&& fill) {
+            return WithStaging([&](StagingBuffer& staging) {
+                auto& commands = staging.Phases[PhaseIndex(phase)].SetTransform;
+
+                const usize first = commands.size();
+                commands.resize(first + count);
+                const usize written = fill(commands.data() + first);
+                VANTA_CORE_ASSERT(written <= count, "Wrote more transform commands than reserved!");
+                commands.resize(first + written);
+
+                uint32_t sequence = NextSequences((uint32_t)written);
+                for (usize i = first; i < first + written; i++)
+                    commands[i].Sequence = sequence++;
+
+                staging.Enqueued += (uint32_t)written;
+                return written;
+            });
+        }
+
         // ------------------------------------------------------------------
         // Apply — called exclusively by Scene at synchronisation points
         // ------------------------------------------------------------------
@@ -92,6 +139,9 @@ namespace Vanta {
         /// counter and are silently skipped in release builds.
         void Apply(entt::registry& registry, CommandPhase phase);
 
+        void SetApplyMode(CommandApplyMode mode) { m_ApplyMode = mode; }
+        CommandApplyMode GetApplyMode() const    { return m_ApplyMode; }
+
         /// Discard all pending commands without applying them.
         /// Used on teardown or when a frame must be abandoned.
         void Flush();
@@ -100,10 +150,11 @@ namespace Vanta {
         // Diagnostics
         // ------------------------------------------------------------------
 
-        const CommandQueueDiagnostics& GetDiagnostics() const { return m_Diagnostics; }
+        /// Diagnostic counters, including commands still sitting in staging buffers.
+        CommandQueueDiagnostics GetDiagnostics() const;
 
         /// Reset diagnostic counters; typically called at the start of each frame.
-        void ResetDiagnostics() { m_Diagnostics.Reset(); }
+        void ResetDiagnostics();
 
         // ------------------------------------------------------------------
         // Inspection helpers (tests + profiler)
@@ -119,18 +170,120 @@ namespace Vanta {
         // Each command variant gets its own vector so Apply can iterate a
         // single type without a polymorphic dispatch, and memory layout stays
         // contiguous and cache-friendly.
-        std::vector<SetPositionCommand>  m_SetPosition;
-        std::vector<SetRotationCommand>  m_SetRotation;
-        std::vector<SetScaleCommand>     m_SetScale;
-        std::vector<SetTransformCommand> m_SetTransform;
+        struct PhaseCommands {
+            std::vector<SetPositionCommand>  SetPosition;
+            std::vector<SetRotationCommand>  SetRotation;
+            std::vector<SetScaleCommand>     SetScale;
+            std::vector<SetTransformCommand> SetTransform;
+
+            usize Size() const {
+                return SetPosition.size() + SetRotation.size() + SetScale.size() + SetTransform.size();
+            }
+
+            void Clear() {
+                SetPosition.clear();
+                SetRotation.clear();
+                SetScale.clear();
+                SetTransform.clear();
+            }
+        };
+
+        // Commands are bucketed by phase, so applying a phase is a single
+        // sweep over its own commands followed by a clear that keeps capacity.
+        std::array<PhaseCommands, COMMAND_PHASE_COUNT> m_Phases;
 
         CommandQueueDiagnostics m_Diagnostics;
+        CommandApplyMode m_ApplyMode = CommandApplyMode::Coalesced;
+
+        // Final state of one entity's transform after coalescing a phase
+        struct CoalescedTransform {
+            static constexpr uint8_t POSITION = 1 << 0;
+            static constexpr uint8_t ROTATION = 1 << 1;
+            static constexpr uint8_t SCALE    = 1 << 2;
+
+            entt::entity Entity = entt::null;
+            glm::vec3 Position    = {};
+            glm::vec3 RotationRad = {};
+            glm::vec3 Scale       = {};
+            uint32_t CommandCount = 0;
+            uint8_t Fields = 0;
+        };
+
+        static constexpr uint32_t INVALID_COALESCE_SLOT = std::numeric_limits<uint32_t>::max();
+
+        /// Fewest entities worth handing to a fiber when writing coalesced transforms.
+        static constexpr usize PARALLEL_APPLY_MIN_ENTITIES = 1024;
+
+        // Scratch storage reused between applies.
+        // Slots map entity index -> entry in m_Coalesced, and are reset after every apply.
+        std::vector<CoalescedTransform> m_Coalesced;
+        std::vector<uint32_t> m_CoalesceSlots;
+        std::vector<CommandQueueDiagnostics> m_JobDiagnostics;
+
+        // Per-thread staging, indexed by CommandProducerSlot().
+        // Aligned to separate cache lines so producers never share one.
+        // The last buffer is the shared one, for threads that didn't get a slot of their own.
+        struct alignas(64) StagingBuffer {
+            std::array<PhaseCommands, COMMAND_PHASE_COUNT> Phases;
+            uint64_t Producer = 0;  // ID of the thread that activated the buffer
+            uint32_t Enqueued = 0;
+            bool Active = false;
+            bool Mixed = false;     // Written by more than one thread since the last merge
+        };
+
+        static_assert(MAX_COMMAND_PRODUCERS + 1 <= 64, "Active producer mask is 64 bits wide");
+
+        std::array<StagingBuffer, MAX_COMMAND_PRODUCERS + 1> m_Staging;
+        std::atomic<uint64_t> m_ActiveProducers = 0;
+        std::mutex m_SharedStagingMutex;
+
+        // Stamped on every staged command, so a write that happens after another on a different thread wins.
+        // Restarts on every merge, while no producers are running.
+        std::atomic<uint32_t> m_NextSequence = 0;
+
+        uint32_t NextSequences(uint32_t count) { return m_NextSequence.fetch_add(count, std::memory_order_relaxed); }
+
+        StagingBuffer& ActivateStaging(usize slot);
+
+        /// Invoke a function with the calling thread's staging buffer, locking it if it's the shared one.
+        template<typename Fn>
+        decltype(auto) WithStaging(Fn&& fn) {
+            const usize slot = CommandProducerSlot();
+            if (slot == SHARED_COMMAND_PRODUCER) {
+                std::scoped_lock lock(m_SharedStagingMutex);
+                return fn(ActivateStaging(slot));
+            }
+            return fn(ActivateStaging(slot));
+        }
+
+        template<typename Cmd>
+        void Stage(std::vector<Cmd> PhaseCommands::* commands, const Cmd& cmd) {
+            WithStaging([&](StagingBuffer& staging) {
+                ++staging.Enqueued;
+                Cmd& staged = (staging.Phases[PhaseIndex(cmd.Phase)].*commands).emplace_back(cmd);
+                staged.Sequence = NextSequences(1);
+            });
+        }
+
+        /// Move all staged commands into the phase buckets.
+        void MergeStaging();
+
+        template<typename Fn>
+        void ForEachActiveStaging(Fn&& fn) const {
+            ForEachCommandProducer(m_ActiveProducers.load(std::memory_order_acquire),
+                [&](usize slot) { fn(m_Staging[slot]); });
+        }
+
+        CoalescedTransform* Coalesce(entt::entity entity);
+        void ApplyCoalesced(entt::registry& registry, const PhaseCommands& commands);
+        void WriteCoalesced(entt::storage_for_t<TransformComponent>& transforms, usize begin, usize end,
+                            CommandQueueDiagnostics& diagnostics) const;
 
-        // Apply helpers — one per command type, templated on iteration.
-        void ApplyPositions (entt::registry& registry, CommandPhase phase);
-        void ApplyRotations (entt::registry& registry, CommandPhase phase);
-        void ApplyScales    (entt::registry& registry, CommandPhase phase);
-        void ApplyTransforms(entt::registry& registry, CommandPhase phase);
+        // Apply helpers — one per command type.
+        void ApplyPositions (entt::registry& registry, const std::vector<SetPositionCommand>&  commands);
+        void ApplyRotations (entt::registry& registry, const std::vector<SetRotationCommand>&  commands);
+        void ApplyScales    (entt::registry& registry, const std::vector<SetScaleCommand>&     commands);
+        void ApplyTransforms(entt::registry& registry, const std::vector<SetTransformCommand>& commands);
     };
 
 } // namespace Vanta
@@ -1,4 +1,5 @@
 #include "vantapch.hpp"
+#include "Vanta/Asset/AssetManager.hpp"
 #include "Vanta/Input/Input.hpp"
 #include "Vanta/Scripts/Instance.hpp"
 #include "Vanta/Scripts/CSharp/Interface.hpp"
@@ -121,6 +122,17 @@ namespace Vanta {
             });
         }
 
+        static void SpriteComponent_SetTexture(UUID id, MonoString* path) {
+            Scene* scene = CSharpScriptEngine::Get().GetContext();
+            VANTA_CORE_ASSERT(scene, "Script engine context not set!");
+            Entity entity = scene->GetEntityByID(id);
+            VANTA_ASSERT(entity, "Entity referenced in script doesn't exist!");
+
+            char* str = mono_string_to_utf8(path);
+            entity.GetComponent<SpriteComponent>().Texture = AssetManager::GetTexture(str);
+            mono_free(str);
+        }
+
         static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(UUID id, glm::vec2* impulse, bool wake) {
             Scene* scene = CSharpScriptEngine::Get().GetContext();
             VANTA_CORE_ASSERT(scene, "Script engine context not set!");
@@ -150,6 +162,8 @@ namespace Vanta {
             VANTA_ADD_INTERNAL_CALL(TransformComponent_GetPosition);
             VANTA_ADD_INTERNAL_CALL(TransformComponent_SetPosition);
 
+            VANTA_ADD_INTERNAL_CALL(SpriteComponent_SetTexture);
+
             VANTA_ADD_INTERNAL_CALL(Rigidbody2DComponent_ApplyLinearImpulseToCenter);
         }
 
@@ -42,6 +42,7 @@ namespace Vanta {
             VANTA_REGISTER_FUNCTION(TransformComponent_SetPosition);
 
             VANTA_REGISTER_FUNCTION(SpriteComponent_SetColor);
+            VANTA_REGISTER_FUNCTION(SpriteComponent_SetTexture);
 
             VANTA_REGISTER_FUNCTION(Rigidbody2DComponent_ApplyLinearImpulseToCenter);
 
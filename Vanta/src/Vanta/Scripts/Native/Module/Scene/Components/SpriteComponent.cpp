@@ -1,4 +1,5 @@
 #include "vantapch.hpp"
+#include "Vanta/Asset/AssetManager.hpp"
 #include "Vanta/Scripts/Native/Module/Scene/Components/SpriteComponent.hpp"
 #include "Vanta/Scripts/Native/ScriptEngine.hpp"
 
@@ -17,5 +18,16 @@ namespace Vanta {
 
             entity.GetComponent<SpriteComponent>().Color = color;
         }
+
+        void SpriteComponent_SetTexture(UUID entityID, const char* path) {
+            Scripts::NativeScriptEngine& engine = Scripts::NativeScriptEngine::Get();
+
+            Scene* scene = engine.GetContext();
+            VANTA_CORE_ASSERT(scene, "Engine scene context not set!");
+            Entity entity = scene->GetEntityByID(entityID);
+            VANTA_CORE_ASSERT(entity, "Entity referenced in script doesn't exist!");
+
+            entity.GetComponent<SpriteComponent>().Texture = AssetManager::GetTexture(path);
+        }
     }
 }
@@ -4,5 +4,6 @@ namespace Vanta {
     namespace NativeImpl {
 
         void SpriteComponent_SetColor(UUID entityID, const glm::vec4& color);
+        void SpriteComponent_SetTexture(UUID entityID, const char* path);
     }
 }
@@ -43,6 +43,9 @@
 // IO
 #include "Vanta/IO/IO.hpp"
 
+// Asset
+#include <Vanta/Asset/AssetManager.hpp>
+
 // Render
 #include <Vanta/Render/Renderer.hpp>
 #include <Vanta/Render/Renderer2D.hpp>